@@ -12,9 +12,12 @@
 
 #include "larpandoracontent/LArHelpers/LArFileHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
+#include <memory>
+
 using namespace pandora;
 
 namespace lar_content
@@ -29,7 +32,8 @@ BdtBeamParticleIdTool::BdtBeamParticleIdTool() :
     m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
     m_maxNeutrinos(std::numeric_limits<int>::max()),
     m_minAdaBDTScore(0.f),
-    m_sliceFeatureParameters(SliceFeatureParameters())
+    m_sliceFeatureParameters(SliceFeatureParameters()),
+    m_nSliceThreads(1)
 {
 }
 
@@ -130,8 +134,56 @@ void BdtBeamParticleIdTool::SelectOutputPfos(const pandora::Algorithm *const pAl
 void BdtBeamParticleIdTool::GetSliceFeatures(
     const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses, SliceFeaturesVector &sliceFeaturesVector) const
 {
-    for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
-        sliceFeaturesVector.push_back(SliceFeatures(nuSliceHypotheses.at(sliceIndex), crSliceHypotheses.at(sliceIndex), m_sliceFeatureParameters));
+    // ATTN slice feature calculation only reads the slice pfos and the geometry information block, so the slices can be processed concurrently
+    std::vector<std::unique_ptr<SliceFeatures>> sliceFeaturesPtrVector(nuSliceHypotheses.size());
+
+    LArParallelHelper::ForEachIndex(sliceFeaturesPtrVector.size(), m_nSliceThreads, [&](const std::size_t sliceIndex) {
+        sliceFeaturesPtrVector.at(sliceIndex) =
+            std::make_unique<SliceFeatures>(nuSliceHypotheses.at(sliceIndex), crSliceHypotheses.at(sliceIndex), m_sliceFeatureParameters);
+    });
+
+    for (const std::unique_ptr<SliceFeatures> &pSliceFeatures : sliceFeaturesPtrVector)
+        sliceFeaturesVector.push_back(*pSliceFeatures);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void BdtBeamParticleIdTool::GetAdaBDTScores(const SliceFeaturesVector &sliceFeaturesVector, FloatVector &adaBDTScores) const
+{
+    // ATTN if one or more of the features can not be calculated, then default to calling the slice a cosmic ray.  -1.f is the minimum score
+    // possible for a weighted bdt.
+    adaBDTScores.assign(sliceFeaturesVector.size(), -1.f);
+
+    std::vector<unsigned int> availableSliceIndices;
+    LArMvaHelper::MvaFeatureVectorList featureVectorList;
+
+    for (unsigned int sliceIndex = 0, nSlices = sliceFeaturesVector.size(); sliceIndex < nSlices; ++sliceIndex)
+    {
+        const SliceFeatures &features(sliceFeaturesVector.at(sliceIndex));
+
+        if (!features.IsFeatureVectorAvailable())
+            continue;
+
+        LArMvaHelper::MvaFeatureVector featureVector;
+
+        try
+        {
+            features.FillFeatureVector(featureVector);
+        }
+        catch (const StatusCodeException &)
+        {
+            std::cout << "BdtBeamParticleIdTool::GetAdaBDTScores - unable to fill feature vector" << std::endl;
+            continue;
+        }
+
+        featureVectorList.push_back(featureVector);
+        availableSliceIndices.push_back(sliceIndex);
+    }
+
+    const std::vector<double> scores(LArMvaHelper::CalculateClassificationScores(m_adaBoostDecisionTree, featureVectorList, m_nSliceThreads));
+
+    for (unsigned int index = 0; index < availableSliceIndices.size(); ++index)
+        adaBDTScores.at(availableSliceIndices.at(index)) = scores.at(index);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -300,10 +352,13 @@ void BdtBeamParticleIdTool::SelectPfosByAdaBDTScore(const pandora::Algorithm *co
     const SliceHypotheses &crSliceHypotheses, const SliceFeaturesVector &sliceFeaturesVector, PfoList &selectedPfos) const
 {
     // Calculate the probability of each slice that passes the minimum probability cut
+    FloatVector adaBDTScores;
+    this->GetAdaBDTScores(sliceFeaturesVector, adaBDTScores);
+
     std::vector<UintFloatPair> sliceIndexAdaBDTScorePairs;
     for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
     {
-        const float nuAdaBDTScore(sliceFeaturesVector.at(sliceIndex).GetAdaBoostDecisionTreeScore(m_adaBoostDecisionTree));
+        const float nuAdaBDTScore(adaBDTScores.at(sliceIndex));
 
         for (const ParticleFlowObject *const pPfo : crSliceHypotheses.at(sliceIndex))
         {
@@ -662,30 +717,6 @@ void BdtBeamParticleIdTool::SliceFeatures::FillFeatureVector(LArMvaHelper::MvaFe
     featureVector.insert(featureVector.end(), m_featureVector.begin(), m_featureVector.end());
 }
 
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-float BdtBeamParticleIdTool::SliceFeatures::GetAdaBoostDecisionTreeScore(const AdaBoostDecisionTree &adaBoostDecisionTree) const
-{
-    // ATTN if one or more of the features can not be calculated, then default to calling the slice a cosmic ray.  -1.f is the minimum score
-    // possible for a weighted bdt.
-    if (!this->IsFeatureVectorAvailable())
-        return -1.f;
-
-    LArMvaHelper::MvaFeatureVector featureVector;
-
-    try
-    {
-        this->FillFeatureVector(featureVector);
-    }
-    catch (const StatusCodeException &statusCodeException)
-    {
-        std::cout << "BdtBeamParticleIdTool::SliceFeatures::GetAdaBoostDecisionTreeScore - unable to fill feature vector" << std::endl;
-        return -1.f;
-    }
-
-    return LArMvaHelper::CalculateClassificationScore(adaBoostDecisionTree, featureVector);
-}
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -732,6 +763,8 @@ StatusCode BdtBeamParticleIdTool::ReadSettings(const TiXmlHandle xmlHandle)
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaximumNeutrinos", m_maxNeutrinos));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NSliceThreads", m_nSliceThreads));
+
     // Geometry Information for training
     FloatVector beamLArTPCIntersection;
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
@@ -256,15 +256,6 @@ private:
          */
         void FillFeatureVector(LArMvaHelper::MvaFeatureVector &featureVector) const;
 
-        /**
-         *  @brief  Get the probability that this slice contains a beam particle
-         *
-         *  @param  adaBoostDecisionTree the adaptive boost decision tree used to calculate the probability
-         *
-         *  @return the probability that the slice contains a beam particle
-         */
-        float GetAdaBoostDecisionTreeScore(const AdaBoostDecisionTree &adaBoostDecisionTree) const;
-
     private:
         /**
          *  @brief  Select a given fraction of a slice's calo hits that are closest to the beam spot
@@ -306,7 +297,7 @@ private:
     pandora::StatusCode Initialize();
 
     /**
-     *  @brief  Get the features of each slice
+     *  @brief  Get the features of each slice, sharing the independent slices between threads
      *
      *  @param  nuSliceHypotheses the input neutrino slice hypotheses
      *  @param  crSliceHypotheses the input cosmic slice hypotheses
@@ -315,6 +306,14 @@ private:
     void GetSliceFeatures(
         const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses, SliceFeaturesVector &sliceFeaturesVector) const;
 
+    /**
+     *  @brief  Get the AdaBDT score that each slice contains a beam particle, scoring all available feature vectors as a single batch
+     *
+     *  @param  sliceFeaturesVector vector holding the slice features
+     *  @param  adaBDTScores to receive the AdaBDT score of each slice, in slice order
+     */
+    void GetAdaBDTScores(const SliceFeaturesVector &sliceFeaturesVector, pandora::FloatVector &adaBDTScores) const;
+
     /**
      *  @brief  Select all pfos under the same hypothesis
      *
@@ -398,6 +397,7 @@ private:
     unsigned int m_maxNeutrinos;                     ///< The maximum number of neutrinos to select in any one event
     float m_minAdaBDTScore;                          ///< Minimum score required to classify a slice as a beam particle
     SliceFeatureParameters m_sliceFeatureParameters; ///< Geometry information block
+    unsigned int m_nSliceThreads;                    ///< The number of threads used to calculate and score slice features, zero for all cores
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -11,10 +11,13 @@
 #include "larpandoracontent/LArControlFlow/CosmicRayTaggingTool.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
+#include <memory>
+
 using namespace pandora;
 
 namespace lar_content
@@ -26,6 +29,7 @@ CosmicRayTaggingTool::CosmicRayTaggingTool() :
     m_positionalUncertainty(3.f),
     m_maxAssociationDist(3.f * 18.f),
     m_minimumHits(15),
+    m_nFitThreads(1),
     m_inTimeMargin(5.f),
     m_inTimeMaxX0(1.f),
     m_marginY(20.f),
@@ -160,7 +164,8 @@ void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos
     const LArTPC *const pFirstLArTPC(this->GetPandora().GetGeometry()->GetLArTPCMap().begin()->second);
     const float layerPitch(pFirstLArTPC->GetWirePitchW());
 
-    PfoToSlidingFitsMap pfoToSlidingFitsMap;
+    PfoVector fitPfoVector;
+    ClusterVector fitClusterVector;
 
     for (const ParticleFlowObject *const pPfo : parentCosmicRayPfos)
     {
@@ -168,28 +173,73 @@ void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos
         if (!this->GetValid3DCluster(pPfo, pCluster) || !pCluster)
             continue;
 
-        (void)pfoToSlidingFitsMap.insert(PfoToSlidingFitsMap::value_type(pPfo,
-            std::make_pair(ThreeDSlidingFitResult(pCluster, 5, layerPitch), ThreeDSlidingFitResult(pCluster, 100, layerPitch)))); // TODO Configurable
+        fitPfoVector.push_back(pPfo);
+        fitClusterVector.push_back(pCluster);
     }
 
-    for (const ParticleFlowObject *const pPfo1 : parentCosmicRayPfos)
+    // ATTN Sliding fits only read the cluster hits, so can be calculated concurrently
+    std::vector<std::unique_ptr<SlidingFitPair>> slidingFitPairs(fitPfoVector.size());
+
+    LArParallelHelper::ForEachIndex(fitPfoVector.size(), m_nFitThreads, [&](const std::size_t index) {
+        const pandora::Cluster *const pCluster(fitClusterVector.at(index));
+        slidingFitPairs.at(index) = std::make_unique<SlidingFitPair>(
+            ThreeDSlidingFitResult(pCluster, 5, layerPitch), ThreeDSlidingFitResult(pCluster, 100, layerPitch)); // TODO Configurable
+    });
+
+    // Index both endpoints of each fitted pfo, so that only pfos with nearby endpoints need be checked for association
+    EndpointKDNode3DList endpointKDNodes;
+    float minX(std::numeric_limits<float>::max()), maxX(-std::numeric_limits<float>::max());
+    float minY(std::numeric_limits<float>::max()), maxY(-std::numeric_limits<float>::max());
+    float minZ(std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+    for (unsigned int index = 0; index < slidingFitPairs.size(); ++index)
     {
-        PfoToSlidingFitsMap::const_iterator iter1(pfoToSlidingFitsMap.find(pPfo1));
-        if (pfoToSlidingFitsMap.end() == iter1)
-            continue;
+        const ThreeDSlidingFitResult &fitPos(slidingFitPairs.at(index)->first);
+
+        for (const CartesianVector &endpoint : {fitPos.GetGlobalMinLayerPosition(), fitPos.GetGlobalMaxLayerPosition()})
+        {
+            endpointKDNodes.emplace_back(index, endpoint.GetX(), endpoint.GetY(), endpoint.GetZ());
+            minX = std::min(minX, endpoint.GetX());
+            maxX = std::max(maxX, endpoint.GetX());
+            minY = std::min(minY, endpoint.GetY());
+            maxY = std::max(maxY, endpoint.GetY());
+            minZ = std::min(minZ, endpoint.GetZ());
+            maxZ = std::max(maxZ, endpoint.GetZ());
+        }
+    }
 
-        const ThreeDSlidingFitResult &fitPos1(iter1->second.first), &fitDir1(iter1->second.second);
+    EndpointKDTree3D kdTree;
+    kdTree.build(endpointKDNodes, KDTreeCube(minX, maxX, minY, maxY, minZ, maxZ));
 
-        for (const ParticleFlowObject *const pPfo2 : parentCosmicRayPfos)
+    const float maxEndpointSeparation(this->GetMaxEndpointSeparation());
+
+    for (unsigned int index1 = 0; index1 < slidingFitPairs.size(); ++index1)
+    {
+        const ParticleFlowObject *const pPfo1(fitPfoVector.at(index1));
+        const ThreeDSlidingFitResult &fitPos1(slidingFitPairs.at(index1)->first), &fitDir1(slidingFitPairs.at(index1)->second);
+
+        std::vector<unsigned int> candidateIndices;
+
+        for (const CartesianVector &endpoint1 : {fitPos1.GetGlobalMinLayerPosition(), fitPos1.GetGlobalMaxLayerPosition()})
         {
-            if (pPfo1 == pPfo2)
-                continue;
+            EndpointKDNode3DList found;
+            kdTree.search(build_3d_kd_search_region(endpoint1, maxEndpointSeparation, maxEndpointSeparation, maxEndpointSeparation), found);
 
-            PfoToSlidingFitsMap::const_iterator iter2(pfoToSlidingFitsMap.find(pPfo2));
-            if (pfoToSlidingFitsMap.end() == iter2)
+            for (const EndpointKDNode3D &node : found)
+                candidateIndices.push_back(node.data);
+        }
+
+        // ATTN Visit candidates in input list order, so that the association lists are filled exactly as by an exhaustive search
+        std::sort(candidateIndices.begin(), candidateIndices.end());
+        candidateIndices.erase(std::unique(candidateIndices.begin(), candidateIndices.end()), candidateIndices.end());
+
+        for (const unsigned int index2 : candidateIndices)
+        {
+            if (index1 == index2)
                 continue;
 
-            const ThreeDSlidingFitResult &fitPos2(iter2->second.first), &fitDir2(iter2->second.second);
+            const ParticleFlowObject *const pPfo2(fitPfoVector.at(index2));
+            const ThreeDSlidingFitResult &fitPos2(slidingFitPairs.at(index2)->first), &fitDir2(slidingFitPairs.at(index2)->second);
 
             // TODO Use existing LArPointingClusters and IsEmission/IsNode logic, for consistency
             if (!(this->CheckAssociation(fitPos1.GetGlobalMinLayerPosition(), fitDir1.GetGlobalMinLayerDirection() * -1.f,
@@ -266,6 +316,20 @@ bool CosmicRayTaggingTool::CheckAssociation(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float CosmicRayTaggingTool::GetMaxEndpointSeparation() const
+{
+    // Associated endpoints satisfy |endPoint2 - endPoint1| <= |d| + |lambda| + |mu|, with each term bounded by the CheckAssociation cuts
+    const float sinDeltaTheta(std::fabs(std::sin(m_angularUncertainty * M_PI / 180.f)));
+    const float maxVertexUncertainty(std::fabs(m_maxAssociationDist * sinDeltaTheta + m_positionalUncertainty));
+    const float maxClosestApproachDist(std::fabs(m_maxAssociationDist) + maxVertexUncertainty);
+    const float maxSeparation(2.f * (1.f + sinDeltaTheta) * maxClosestApproachDist + std::fabs(m_positionalUncertainty));
+
+    // ATTN Small margin to absorb floating point rounding in the association calculation
+    return 1.01f * maxSeparation + std::numeric_limits<float>::epsilon();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void CosmicRayTaggingTool::SliceEvent(const PfoList &parentCosmicRayPfos, const PfoToPfoListMap &pfoAssociationMap, PfoToSliceIdMap &pfoToSliceIdMap) const
 {
     SliceList sliceList;
@@ -329,9 +393,19 @@ void CosmicRayTaggingTool::GetCRCandidates(const PfoList &parentCosmicRayPfos, c
     {
         if (!LArPfoHelper::IsFinalState(pPfo))
             throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
-
-        candidates.push_back(CRCandidate(this->GetPandora(), pPfo, pfoToSliceIdMap.at(pPfo)));
     }
+
+    // ATTN Candidate construction performs a sliding fit for each pfo, so candidates are constructed concurrently
+    const PfoVector pfoVector(parentCosmicRayPfos.begin(), parentCosmicRayPfos.end());
+    std::vector<std::unique_ptr<CRCandidate>> candidatePtrs(pfoVector.size());
+
+    LArParallelHelper::ForEachIndex(pfoVector.size(), m_nFitThreads, [&](const std::size_t index) {
+        const ParticleFlowObject *const pPfo(pfoVector.at(index));
+        candidatePtrs.at(index) = std::make_unique<CRCandidate>(this->GetPandora(), pPfo, pfoToSliceIdMap.at(pPfo));
+    });
+
+    for (const std::unique_ptr<CRCandidate> &pCandidate : candidatePtrs)
+        candidates.push_back(*pCandidate);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -611,6 +685,8 @@ StatusCode CosmicRayTaggingTool::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxCosmicCurvature", m_maxCosmicCurvature));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NFitThreads", m_nFitThreads));
+
     return STATUS_CODE_SUCCESS;
 }
 
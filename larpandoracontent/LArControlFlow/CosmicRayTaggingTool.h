@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 #include <unordered_map>
 
 namespace lar_content
@@ -100,6 +102,13 @@ private:
     bool CheckAssociation(const pandora::CartesianVector &endPoint1, const pandora::CartesianVector &endDir1,
         const pandora::CartesianVector &endPoint2, const pandora::CartesianVector &endDir2) const;
 
+    /**
+     *  @brief  Get an upper bound on the separation of two Pfo endpoints that can pass the CheckAssociation requirements
+     *
+     *  @return the maximum endpoint separation
+     */
+    float GetMaxEndpointSeparation() const;
+
     typedef std::unordered_map<const pandora::ParticleFlowObject *, unsigned int> PfoToSliceIdMap;
 
     /**
@@ -184,9 +193,12 @@ private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     typedef std::pair<const ThreeDSlidingFitResult, const ThreeDSlidingFitResult> SlidingFitPair;
-    typedef std::unordered_map<const pandora::ParticleFlowObject *, SlidingFitPair> PfoToSlidingFitsMap;
     typedef std::vector<pandora::PfoList> SliceList;
 
+    typedef KDTreeLinkerAlgo<unsigned int, 3> EndpointKDTree3D;
+    typedef KDTreeNodeInfoT<unsigned int, 3> EndpointKDNode3D;
+    typedef std::vector<EndpointKDNode3D> EndpointKDNode3DList;
+
     /**
      *  @brief  Choose a set of cuts using a keyword - "cautious" = remove as few neutrinos as possible
      *          "nominal" = optimised to maximise CR removal whilst preserving neutrinos
@@ -199,6 +211,7 @@ private:
     float m_maxAssociationDist; ///< The maximum distance from endpoint to point of closest approach, typically a multiple of LAr radiation length
 
     unsigned int m_minimumHits; ///< The minimum number of hits for a Pfo to be considered
+    unsigned int m_nFitThreads; ///< The number of threads used to calculate the Pfo sliding fits, zero to use the hardware concurrency
 
     float m_inTimeMargin; ///< The maximum distance outside of the physical detector volume that a Pfo may be to still be considered in time
     float m_inTimeMaxX0;  ///< The maximum pfo x0 (determined from shifted vertex) to allow pfo to still be considered in time
@@ -12,6 +12,7 @@
 
 #include "larpandoracontent/LArContent.h"
 #include "larpandoracontent/LArControlFlow/MasterAlgorithm.h"
+#include "larpandoracontent/LArControlFlow/ReconstructionProfiler.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArFileHelper.h"
@@ -50,6 +51,8 @@ MasterAlgorithm::MasterAlgorithm() :
     m_pSliceCRWorkerInstance(nullptr),
     m_fullWidthCRWorkerWireGaps(true),
     m_passMCParticlesToWorkerInstances(false),
+    m_streamCRWorkers(false),
+    m_maxLiveCRWorkers(1),
     m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
     m_inTimeMaxX0(1.f)
 {
@@ -57,6 +60,17 @@ MasterAlgorithm::MasterAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+MasterAlgorithm::~MasterAlgorithm()
+{
+    if (m_pProfiler && !m_profilingReportFileName.empty())
+        (void)m_pProfiler->WriteReport(m_profilingReportFileName);
+
+    if (m_pProfiler && !m_memoryReportFileName.empty())
+        (void)m_pProfiler->WriteMemoryReport(m_memoryReportFileName);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void MasterAlgorithm::ShiftPfoHierarchy(const ParticleFlowObject *const pParentPfo, const PfoToLArTPCMap &pfoToLArTPCMap, const float x0) const
 {
     if (!pParentPfo->GetParentPfoList().empty())
@@ -152,6 +166,9 @@ void MasterAlgorithm::StitchPfos(
 
 StatusCode MasterAlgorithm::Run()
 {
+    if (m_pProfiler)
+        m_pProfiler->StartEvent();
+
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Reset());
 
     if (!m_workerInstancesInitialized)
@@ -166,10 +183,17 @@ StatusCode MasterAlgorithm::Run()
 
     if (m_shouldRunAllHitsCosmicReco)
     {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunCosmicRayReconstruction(volumeIdToHitListMap));
-
         PfoToLArTPCMap pfoToLArTPCMap;
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RecreateCosmicRayPfos(pfoToLArTPCMap));
+
+        if (m_streamCRWorkers)
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunStreamedCosmicRayReconstruction(volumeIdToHitListMap, pfoToLArTPCMap));
+        }
+        else
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunCosmicRayReconstruction(volumeIdToHitListMap));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RecreateCosmicRayPfos(m_crWorkerInstances, pfoToLArTPCMap));
+        }
 
         if (m_shouldRunStitching)
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->StitchCosmicRayPfos(pfoToLArTPCMap, stitchedPfosToX0Map));
@@ -192,6 +216,9 @@ StatusCode MasterAlgorithm::Run()
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SelectBestSliceHypotheses(nuSliceHypotheses, crSliceHypotheses));
     }
 
+    if (m_pProfiler)
+        m_pProfiler->EndEvent();
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -238,6 +265,8 @@ StatusCode MasterAlgorithm::InitializeWorkerInstances()
 
 StatusCode MasterAlgorithm::CopyMCParticles() const
 {
+    const ReconstructionProfiler::ScopedTimer scopedTimer(m_pProfiler.get(), "MasterAlgorithm::CopyMCParticles");
+
     const MCParticleList *pMCParticleList(nullptr);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, m_inputMCParticleListName, pMCParticleList));
 
@@ -264,6 +293,8 @@ StatusCode MasterAlgorithm::CopyMCParticles() const
 
 StatusCode MasterAlgorithm::GetVolumeIdToHitListMap(VolumeIdToHitListMap &volumeIdToHitListMap) const
 {
+    const ReconstructionProfiler::ScopedTimer scopedTimer(m_pProfiler.get(), "MasterAlgorithm::GetVolumeIdToHitListMap");
+
     const LArTPCMap &larTPCMap(this->GetPandora().GetGeometry()->GetLArTPCMap());
     const unsigned int nLArTPCs(larTPCMap.size());
 
@@ -297,33 +328,74 @@ StatusCode MasterAlgorithm::GetVolumeIdToHitListMap(VolumeIdToHitListMap &volume
 
 StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMap &volumeIdToHitListMap) const
 {
+    const ReconstructionProfiler::ScopedTimer scopedTimer(m_pProfiler.get(), "MasterAlgorithm::RunCosmicRayReconstruction");
+
     unsigned int workerCounter(0);
 
     for (const Pandora *const pCRWorker : m_crWorkerInstances)
     {
-        const LArTPC &larTPC(pCRWorker->GetGeometry()->GetLArTPC());
-        VolumeIdToHitListMap::const_iterator iter(volumeIdToHitListMap.find(larTPC.GetLArTPCVolumeId()));
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, this->RunCosmicRayWorker(pCRWorker, volumeIdToHitListMap, workerCounter));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
 
-        if (volumeIdToHitListMap.end() == iter)
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::RunCosmicRayWorker(
+    const Pandora *const pCRWorker, const VolumeIdToHitListMap &volumeIdToHitListMap, unsigned int &workerCounter) const
+{
+    const LArTPC &larTPC(pCRWorker->GetGeometry()->GetLArTPC());
+    VolumeIdToHitListMap::const_iterator iter(volumeIdToHitListMap.find(larTPC.GetLArTPCVolumeId()));
+
+    if (volumeIdToHitListMap.end() == iter)
+        return STATUS_CODE_NOT_FOUND;
+
+    for (const CaloHit *const pCaloHit : iter->second.m_allHitList)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pCRWorker, pCaloHit));
+
+    if (m_printOverallRecoStatus)
+        std::cout << "Running cosmic-ray reconstruction worker instance " << ++workerCounter << " of " << m_crWorkerInstances.size() << std::endl;
+
+    return this->ProcessWorkerEvent(pCRWorker, "CRWorkerInstance");
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::RunStreamedCosmicRayReconstruction(const VolumeIdToHitListMap &volumeIdToHitListMap, PfoToLArTPCMap &pfoToLArTPCMap) const
+{
+    const ReconstructionProfiler::ScopedTimer scopedTimer(m_pProfiler.get(), "MasterAlgorithm::RunStreamedCosmicRayReconstruction");
+
+    unsigned int workerCounter(0);
+    PandoraInstanceList liveCRWorkerInstances;
+
+    for (const Pandora *const pCRWorker : m_crWorkerInstances)
+    {
+        const StatusCode statusCode(this->RunCosmicRayWorker(pCRWorker, volumeIdToHitListMap, workerCounter));
+
+        if (STATUS_CODE_NOT_FOUND == statusCode)
             continue;
 
-        for (const CaloHit *const pCaloHit : iter->second.m_allHitList)
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pCRWorker, pCaloHit));
+        if (STATUS_CODE_SUCCESS != statusCode)
+            return statusCode;
 
-        if (m_printOverallRecoStatus)
-            std::cout << "Running cosmic-ray reconstruction worker instance " << ++workerCounter << " of " << m_crWorkerInstances.size() << std::endl;
+        liveCRWorkerInstances.push_back(pCRWorker);
 
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pCRWorker));
+        if (liveCRWorkerInstances.size() >= m_maxLiveCRWorkers)
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReleaseCosmicRayWorkers(liveCRWorkerInstances, pfoToLArTPCMap));
     }
 
-    return STATUS_CODE_SUCCESS;
+    return this->ReleaseCosmicRayWorkers(liveCRWorkerInstances, pfoToLArTPCMap);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode MasterAlgorithm::RecreateCosmicRayPfos(PfoToLArTPCMap &pfoToLArTPCMap) const
+StatusCode MasterAlgorithm::RecreateCosmicRayPfos(const PandoraInstanceList &crWorkerInstances, PfoToLArTPCMap &pfoToLArTPCMap) const
 {
-    for (const Pandora *const pCRWorker : m_crWorkerInstances)
+    const ReconstructionProfiler::ScopedTimer scopedTimer(m_pProfiler.get(), "MasterAlgorithm::RecreateCosmicRayPfos");
+
+    for (const Pandora *const pCRWorker : crWorkerInstances)
     {
         const PfoList *pCRPfos(nullptr);
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*pCRWorker, pCRPfos));
@@ -342,8 +414,29 @@ StatusCode MasterAlgorithm::RecreateCosmicRayPfos(PfoToLArTPCMap &pfoToLArTPCMap
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode MasterAlgorithm::ReleaseCosmicRayWorkers(PandoraInstanceList &liveCRWorkerInstances, PfoToLArTPCMap &pfoToLArTPCMap) const
+{
+    if (liveCRWorkerInstances.empty())
+        return STATUS_CODE_SUCCESS;
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RecreateCosmicRayPfos(liveCRWorkerInstances, pfoToLArTPCMap));
+
+    // ATTN Recreated pfos, clusters and vertices only reference master instance hits, so the worker event output can be released
+    const ReconstructionProfiler::ScopedTimer scopedTimer(m_pProfiler.get(), "MasterAlgorithm::ResetCosmicRayWorkers");
+
+    for (const Pandora *const pCRWorker : liveCRWorkerInstances)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pCRWorker));
+
+    liveCRWorkerInstances.clear();
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::StitchCosmicRayPfos(PfoToLArTPCMap &pfoToLArTPCMap, PfoToFloatMap &stitchedPfosToX0Map) const
 {
+    const ReconstructionProfiler::ScopedTimer scopedTimer(m_pProfiler.get(), "MasterAlgorithm::StitchCosmicRayPfos");
+
     const PfoList *pRecreatedCRPfos(nullptr);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(this->GetPandora(), pRecreatedCRPfos));
 
@@ -354,7 +447,10 @@ StatusCode MasterAlgorithm::StitchCosmicRayPfos(PfoToLArTPCMap &pfoToLArTPCMap,
     }
 
     for (StitchingBaseTool *const pStitchingTool : m_stitchingToolVector)
+    {
+        const ReconstructionProfiler::ScopedTimer toolTimer(m_pProfiler.get(), pStitchingTool->GetInstanceName());
         pStitchingTool->Run(this, pRecreatedCRPfos, pfoToLArTPCMap, stitchedPfosToX0Map);
+    }
 
     if (m_visualizeOverallRecoStatus)
     {
@@ -369,6 +465,8 @@ StatusCode MasterAlgorithm::StitchCosmicRayPfos(PfoToLArTPCMap &pfoToLArTPCMap,
 
 StatusCode MasterAlgorithm::TagCosmicRayPfos(const PfoToFloatMap &stitchedPfosToX0Map, PfoList &clearCosmicRayPfos, PfoList &ambiguousPfos) const
 {
+    const ReconstructionProfiler::ScopedTimer scopedTimer(m_pProfiler.get(), "MasterAlgorithm::TagCosmicRayPfos");
+
     const PfoList *pRecreatedCRPfos(nullptr);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(this->GetPandora(), pRecreatedCRPfos));
 
@@ -385,7 +483,10 @@ StatusCode MasterAlgorithm::TagCosmicRayPfos(const PfoToFloatMap &stitchedPfosTo
     }
 
     for (CosmicRayTaggingBaseTool *const pCosmicRayTaggingTool : m_cosmicRayTaggingToolVector)
+    {
+        const ReconstructionProfiler::ScopedTimer toolTimer(m_pProfiler.get(), pCosmicRayTaggingTool->GetInstanceName());
         pCosmicRayTaggingTool->FindAmbiguousPfos(nonStitchedParentCosmicRayPfos, ambiguousPfos, this);
+    }
 
     for (const Pfo *const pPfo : nonStitchedParentCosmicRayPfos)
     {
@@ -417,6 +518,8 @@ StatusCode MasterAlgorithm::TagCosmicRayPfos(const PfoToFloatMap &stitchedPfosTo
 
 StatusCode MasterAlgorithm::RunCosmicRayHitRemoval(const PfoList &ambiguousPfos) const
 {
+    const ReconstructionProfiler::ScopedTimer scopedTimer(m_pProfiler.get(), "MasterAlgorithm::RunCosmicRayHitRemoval");
+
     PfoList allPfosToDelete;
     LArPfoHelper::GetAllConnectedPfos(ambiguousPfos, allPfosToDelete);
 
@@ -456,6 +559,8 @@ StatusCode MasterAlgorithm::RunCosmicRayHitRemoval(const PfoList &ambiguousPfos)
 
 StatusCode MasterAlgorithm::RunSlicing(const VolumeIdToHitListMap &volumeIdToHitListMap, SliceVector &sliceVector) const
 {
+    const ReconstructionProfiler::ScopedTimer scopedTimer(m_pProfiler.get(), "MasterAlgorithm::RunSlicing");
+
     for (const VolumeIdToHitListMap::value_type &mapEntry : volumeIdToHitListMap)
     {
         for (const CaloHit *const pCaloHit : (m_shouldRemoveOutOfTimeHits ? mapEntry.second.m_truncatedHitList : mapEntry.second.m_allHitList))
@@ -486,7 +591,7 @@ StatusCode MasterAlgorithm::RunSlicing(const VolumeIdToHitListMap &volumeIdToHit
             std::cout << "Running slicing worker instance" << std::endl;
 
         const PfoList *pSlicePfos(nullptr);
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSlicingWorkerInstance));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ProcessWorkerEvent(m_pSlicingWorkerInstance, "SlicingWorker"));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSlicingWorkerInstance, pSlicePfos));
 
         if (m_visualizeOverallRecoStatus)
@@ -514,12 +619,15 @@ StatusCode MasterAlgorithm::RunSlicing(const VolumeIdToHitListMap &volumeIdToHit
 
 StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses, SliceHypotheses &crSliceHypotheses) const
 {
+    const ReconstructionProfiler::ScopedTimer scopedTimer(m_pProfiler.get(), "MasterAlgorithm::RunSliceReconstruction");
+
     SliceVector selectedSliceVector;
     if (m_shouldRunSlicing && !m_sliceSelectionToolVector.empty())
     {
         SliceVector inputSliceVector(sliceVector);
         for (SliceSelectionBaseTool *const pSliceSelectionTool : m_sliceSelectionToolVector)
         {
+            const ReconstructionProfiler::ScopedTimer toolTimer(m_pProfiler.get(), pSliceSelectionTool->GetInstanceName());
             pSliceSelectionTool->SelectSlices(this, inputSliceVector, selectedSliceVector);
             inputSliceVector = selectedSliceVector;
         }
@@ -551,7 +659,7 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
                 std::cout << "Running nu worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
 
             const PfoList *pSliceNuPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceNuWorkerInstance));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ProcessWorkerEvent(m_pSliceNuWorkerInstance, "SliceNuWorker"));
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceNuWorkerInstance, pSliceNuPfos));
             nuSliceHypotheses.push_back(*pSliceNuPfos);
 
@@ -569,7 +677,7 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
                 std::cout << "Running cr worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
 
             const PfoList *pSliceCRPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceCRWorkerInstance));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ProcessWorkerEvent(m_pSliceCRWorkerInstance, "SliceCRWorker"));
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceCRWorkerInstance, pSliceCRPfos));
             crSliceHypotheses.push_back(*pSliceCRPfos);
 
@@ -599,6 +707,8 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
 
 StatusCode MasterAlgorithm::SelectBestSliceHypotheses(const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses) const
 {
+    const ReconstructionProfiler::ScopedTimer scopedTimer(m_pProfiler.get(), "MasterAlgorithm::SelectBestSliceHypotheses");
+
     if (m_printOverallRecoStatus)
         std::cout << "Select best slice hypotheses" << std::endl;
 
@@ -607,7 +717,10 @@ StatusCode MasterAlgorithm::SelectBestSliceHypotheses(const SliceHypotheses &nuS
     if (m_shouldPerformSliceId)
     {
         for (SliceIdBaseTool *const pSliceIdTool : m_sliceIdToolVector)
+        {
+            const ReconstructionProfiler::ScopedTimer toolTimer(m_pProfiler.get(), pSliceIdTool->GetInstanceName());
             pSliceIdTool->SelectOutputPfos(this, nuSliceHypotheses, crSliceHypotheses, selectedSlicePfos);
+        }
     }
     else if (m_shouldRunNeutrinoRecoOption != m_shouldRunCosmicRecoOption)
     {
@@ -625,6 +738,15 @@ StatusCode MasterAlgorithm::SelectBestSliceHypotheses(const SliceHypotheses &nuS
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode MasterAlgorithm::ProcessWorkerEvent(const Pandora *const pPandora, const std::string &stepName) const
+{
+    const ReconstructionProfiler::ScopedTimer scopedTimer(m_pProfiler.get(), stepName);
+
+    return PandoraApi::ProcessEvent(*pPandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::Reset()
 {
     for (const Pandora *const pCRWorker : m_crWorkerInstances)
@@ -1226,6 +1348,27 @@ StatusCode MasterAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "PassMCParticlesToWorkerInstances", m_passMCParticlesToWorkerInstances));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "StreamCRWorkers", m_streamCRWorkers));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxLiveCRWorkers", m_maxLiveCRWorkers));
+
+    if (0 == m_maxLiveCRWorkers)
+    {
+        std::cout << "MasterAlgorithm::ReadSettings - MaxLiveCRWorkers must be greater than zero" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ProfilingReportFileName", m_profilingReportFileName));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "MemoryReportFileName", m_memoryReportFileName));
+
+    if (!m_profilingReportFileName.empty() || !m_memoryReportFileName.empty())
+        m_pProfiler = std::make_unique<ReconstructionProfiler>(!m_memoryReportFileName.empty());
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "FilePathEnvironmentVariable", m_filePathEnvironmentVariable));
 
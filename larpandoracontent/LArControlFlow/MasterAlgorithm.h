@@ -14,6 +14,7 @@
 #include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
+#include <memory>
 #include <unordered_map>
 
 namespace lar_content
@@ -24,6 +25,7 @@ class CosmicRayTaggingBaseTool;
 class SliceIdBaseTool;
 class SliceSelectionBaseTool;
 class LArMCParticleFactory;
+class ReconstructionProfiler;
 
 typedef std::vector<pandora::CaloHitList> SliceVector;
 typedef std::vector<pandora::PfoList> SliceHypotheses;
@@ -43,6 +45,11 @@ public:
      */
     MasterAlgorithm();
 
+    /**
+     *  @brief  Destructor, writing the profiling report if profiling is enabled
+     */
+    ~MasterAlgorithm();
+
     /**
      *  @brief  External steering parameters class
      */
@@ -119,12 +126,42 @@ protected:
      */
     pandora::StatusCode RunCosmicRayReconstruction(const VolumeIdToHitListMap &volumeIdToHitListMap) const;
 
+    /**
+     *  @brief  Copy the hits for the lar tpc of a cosmic-ray reconstruction worker instance to the worker and process its event
+     *
+     *  @param  pCRWorker the address of the cosmic-ray reconstruction worker instance
+     *  @param  volumeIdToHitListMap the volume id to hit list map
+     *  @param  workerCounter the number of worker instances run so far, incremented if this worker instance is run
+     *
+     *  @return STATUS_CODE_NOT_FOUND if there are no hits for the lar tpc of the worker instance
+     */
+    pandora::StatusCode RunCosmicRayWorker(
+        const pandora::Pandora *const pCRWorker, const VolumeIdToHitListMap &volumeIdToHitListMap, unsigned int &workerCounter) const;
+
+    /**
+     *  @brief  Run the cosmic-ray reconstruction worker instances, recreating the pfos from each group of at most m_maxLiveCRWorkers
+     *          worker instances in the master instance and then resetting those worker instances, before processing the next group
+     *
+     *  @param  volumeIdToHitListMap the volume id to hit list map
+     *  @param  pfoToLArTPCMap to receive the populated pfo to lar tpc map
+     */
+    pandora::StatusCode RunStreamedCosmicRayReconstruction(const VolumeIdToHitListMap &volumeIdToHitListMap, PfoToLArTPCMap &pfoToLArTPCMap) const;
+
     /**
      *  @brief  Recreate cosmic-ray pfos (created by worker instances) in the master instance
      *
+     *  @param  crWorkerInstances the cosmic-ray reconstruction worker instances
+     *  @param  pfoToLArTPCMap to receive the populated pfo to lar tpc map
+     */
+    pandora::StatusCode RecreateCosmicRayPfos(const PandoraInstanceList &crWorkerInstances, PfoToLArTPCMap &pfoToLArTPCMap) const;
+
+    /**
+     *  @brief  Recreate cosmic-ray pfos from the provided worker instances in the master instance, then reset and release the worker instances
+     *
+     *  @param  liveCRWorkerInstances the live cosmic-ray reconstruction worker instances, cleared on return
      *  @param  pfoToLArTPCMap to receive the populated pfo to lar tpc map
      */
-    pandora::StatusCode RecreateCosmicRayPfos(PfoToLArTPCMap &pfoToLArTPCMap) const;
+    pandora::StatusCode ReleaseCosmicRayWorkers(PandoraInstanceList &liveCRWorkerInstances, PfoToLArTPCMap &pfoToLArTPCMap) const;
 
     /**
      *  @brief  Stitch together cosmic-ray pfos crossing between adjacent lar tpcs
@@ -176,6 +213,14 @@ protected:
      */
     pandora::StatusCode SelectBestSliceHypotheses(const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses) const;
 
+    /**
+     *  @brief  Process the current event in a worker instance, recording the wall time taken if profiling is enabled
+     *
+     *  @param  pPandora the address of the worker instance
+     *  @param  stepName the profiling step name for the worker instance
+     */
+    pandora::StatusCode ProcessWorkerEvent(const pandora::Pandora *const pPandora, const std::string &stepName) const;
+
     /**
      *  @brief  Reset all worker instances
      */
@@ -329,6 +374,8 @@ protected:
 
     bool m_fullWidthCRWorkerWireGaps;        ///< Whether wire-type line gaps in cosmic-ray worker instances should cover all drift time
     bool m_passMCParticlesToWorkerInstances; ///< Whether to pass mc particle details (and links to calo hits) to worker instances
+    bool m_streamCRWorkers;                  ///< Whether to recreate cosmic-ray worker output in the master and reset workers as they finish
+    unsigned int m_maxLiveCRWorkers;         ///< The maximum number of cosmic-ray worker instances holding event output, if streaming
 
     typedef std::vector<StitchingBaseTool *> StitchingToolVector;
     typedef std::vector<CosmicRayTaggingBaseTool *> CosmicRayTaggingToolVector;
@@ -353,6 +400,10 @@ protected:
 
     float m_inTimeMaxX0;                   ///< Cut on X0 to determine whether particle is clear cosmic ray
     LArCaloHitFactory m_larCaloHitFactory; ///< Factory for creating LArCaloHits during hit copying
+
+    std::string m_profilingReportFileName;               ///< The profiling report file name, profiling is enabled if this is set
+    std::string m_memoryReportFileName;                  ///< The memory accounting report file name, memory accounting is enabled if this is set
+    std::unique_ptr<ReconstructionProfiler> m_pProfiler; ///< The profiler for master stages, worker instances and tools, if enabled
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -15,11 +15,14 @@
 #include "larpandoracontent/LArHelpers/LArFileHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
+#include <memory>
+
 using namespace pandora;
 
 namespace lar_content
@@ -34,7 +37,8 @@ NeutrinoIdTool<T>::NeutrinoIdTool() :
     m_minCompleteness(0.9f),
     m_minProbability(0.0f),
     m_maxNeutrinos(1),
-    m_filePathEnvironmentVariable("FW_SEARCH_PATH")
+    m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
+    m_nSliceThreads(1)
 {
 }
 
@@ -86,8 +90,46 @@ template <typename T>
 void NeutrinoIdTool<T>::GetSliceFeatures(const NeutrinoIdTool<T> *const pTool, const SliceHypotheses &nuSliceHypotheses,
     const SliceHypotheses &crSliceHypotheses, SliceFeaturesVector &sliceFeaturesVector) const
 {
-    for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
-        sliceFeaturesVector.push_back(SliceFeatures(nuSliceHypotheses.at(sliceIndex), crSliceHypotheses.at(sliceIndex), pTool));
+    // ATTN slice feature calculation only reads the slice pfos and the detector geometry, so the slices can be processed concurrently
+    std::vector<std::unique_ptr<SliceFeatures>> sliceFeaturesPtrVector(nuSliceHypotheses.size());
+
+    LArParallelHelper::ForEachIndex(sliceFeaturesPtrVector.size(), m_nSliceThreads, [&](const std::size_t sliceIndex) {
+        sliceFeaturesPtrVector.at(sliceIndex) =
+            std::make_unique<SliceFeatures>(nuSliceHypotheses.at(sliceIndex), crSliceHypotheses.at(sliceIndex), pTool);
+    });
+
+    for (const std::unique_ptr<SliceFeatures> &pSliceFeatures : sliceFeaturesPtrVector)
+        sliceFeaturesVector.push_back(*pSliceFeatures);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void NeutrinoIdTool<T>::GetNeutrinoProbabilities(const SliceFeaturesVector &sliceFeaturesVector, FloatVector &nuProbabilities) const
+{
+    // ATTN if one or more of the features can not be calculated, then default to calling the slice a cosmic ray
+    nuProbabilities.assign(sliceFeaturesVector.size(), 0.f);
+
+    std::vector<unsigned int> availableSliceIndices;
+    LArMvaHelper::MvaFeatureVectorList featureVectorList;
+
+    for (unsigned int sliceIndex = 0, nSlices = sliceFeaturesVector.size(); sliceIndex < nSlices; ++sliceIndex)
+    {
+        const SliceFeatures &features(sliceFeaturesVector.at(sliceIndex));
+
+        if (!features.IsFeatureVectorAvailable())
+            continue;
+
+        LArMvaHelper::MvaFeatureVector featureVector;
+        features.GetFeatureVector(featureVector);
+        featureVectorList.push_back(featureVector);
+        availableSliceIndices.push_back(sliceIndex);
+    }
+
+    const std::vector<double> probabilities(LArMvaHelper::CalculateProbabilities(m_mva, featureVectorList, m_nSliceThreads));
+
+    for (unsigned int index = 0; index < availableSliceIndices.size(); ++index)
+        nuProbabilities.at(availableSliceIndices.at(index)) = probabilities.at(index);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -246,10 +288,13 @@ void NeutrinoIdTool<T>::SelectPfosByProbability(const pandora::Algorithm *const
     const SliceHypotheses &crSliceHypotheses, const SliceFeaturesVector &sliceFeaturesVector, PfoList &selectedPfos) const
 {
     // Calculate the probability of each slice that passes the minimum probability cut
+    FloatVector nuProbabilities;
+    this->GetNeutrinoProbabilities(sliceFeaturesVector, nuProbabilities);
+
     std::vector<UintFloatPair> sliceIndexProbabilityPairs;
     for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
     {
-        const float nuProbability(sliceFeaturesVector.at(sliceIndex).GetNeutrinoProbability(m_mva));
+        const float nuProbability(nuProbabilities.at(sliceIndex));
 
         for (const ParticleFlowObject *const pPfo : crSliceHypotheses.at(sliceIndex))
         {
@@ -433,20 +478,6 @@ void NeutrinoIdTool<T>::SliceFeatures::GetFeatureVector(LArMvaHelper::MvaFeature
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-template <typename T>
-float NeutrinoIdTool<T>::SliceFeatures::GetNeutrinoProbability(const T &t) const
-{
-    // ATTN if one or more of the features can not be calculated, then default to calling the slice a cosmic ray
-    if (!this->IsFeatureVectorAvailable())
-        return 0.f;
-
-    LArMvaHelper::MvaFeatureVector featureVector;
-    this->GetFeatureVector(featureVector);
-    return LArMvaHelper::CalculateProbability(t, featureVector);
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 template <typename T>
 const ParticleFlowObject *NeutrinoIdTool<T>::SliceFeatures::GetNeutrino(const PfoList &nuPfos) const
 {
@@ -574,6 +605,8 @@ StatusCode NeutrinoIdTool<T>::ReadSettings(const TiXmlHandle xmlHandle)
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaximumNeutrinos", m_maxNeutrinos));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NSliceThreads", m_nSliceThreads));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "FilePathEnvironmentVariable", m_filePathEnvironmentVariable));
 
@@ -70,15 +70,6 @@ private:
          */
         void GetFeatureVector(LArMvaHelper::MvaFeatureVector &featureVector) const;
 
-        /**
-         *  @brief  Get the probability that this slice contains a neutrino interaction
-         *
-         *  @param  t the MVA used to calculate the probability
-         *
-         *  @return the probability that the slice contains a neutrino interaction
-         */
-        float GetNeutrinoProbability(const T &t) const;
-
     private:
         /**
          *  @brief  Get the recontructed neutrino the input list of neutrino Pfos
@@ -154,7 +145,7 @@ private:
     typedef std::vector<SliceFeatures> SliceFeaturesVector;
 
     /**
-     *  @brief  Get the features of each slice
+     *  @brief  Get the features of each slice, sharing the independent slices between threads
      *
      *  @param  pTool the address of the this NeutrinoId tool
      *  @param  nuSliceHypotheses the input neutrino slice hypotheses
@@ -164,6 +155,14 @@ private:
     void GetSliceFeatures(const NeutrinoIdTool *const pTool, const SliceHypotheses &nuSliceHypotheses,
         const SliceHypotheses &crSliceHypotheses, SliceFeaturesVector &sliceFeaturesVector) const;
 
+    /**
+     *  @brief  Get the probability that each slice contains a neutrino interaction, scoring all available feature vectors as a single batch
+     *
+     *  @param  sliceFeaturesVector vector holding the slice features
+     *  @param  nuProbabilities to receive the neutrino probability of each slice, in slice order
+     */
+    void GetNeutrinoProbabilities(const SliceFeaturesVector &sliceFeaturesVector, pandora::FloatVector &nuProbabilities) const;
+
     /**
      *  @brief  Get the slice with the most neutrino induced hits using Monte-Carlo information
      *
@@ -261,6 +260,8 @@ private:
 
     T m_mva;                                   ///< The mva
     std::string m_filePathEnvironmentVariable; ///< The environment variable providing a list of paths to mva files
+
+    unsigned int m_nSliceThreads; ///< The number of threads used to calculate and score slice features, zero for the hardware concurrency
 };
 
 typedef NeutrinoIdTool<AdaBoostDecisionTree> BdtNeutrinoIdTool;
@@ -0,0 +1,241 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/ReconstructionProfiler.cc
+ *
+ *  @brief  Implementation of the reconstruction profiler class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArControlFlow/ReconstructionProfiler.h"
+
+#include "larpandoracontent/LArObjects/LArEventArena.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+namespace lar_content
+{
+
+ReconstructionProfiler::ReconstructionProfiler(const bool shouldRecordMemory) :
+    m_isEventOpen(false),
+    m_nEvents(0),
+    m_shouldRecordMemory(shouldRecordMemory)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ReconstructionProfiler::StartEvent()
+{
+    // ATTN Events can end early if a stage returns an error, so close any open event here
+    if (m_isEventOpen)
+        this->EndEvent();
+
+    m_isEventOpen = true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ReconstructionProfiler::EndEvent()
+{
+    if (!m_isEventOpen)
+        return;
+
+    for (StepRecordMap::value_type &mapEntry : m_stepRecordMap)
+    {
+        StepRecord &stepRecord(mapEntry.second);
+
+        if (0 == stepRecord.m_nEventCalls)
+            continue;
+
+        stepRecord.m_nCalls += stepRecord.m_nEventCalls;
+        stepRecord.m_eventWallTimes.push_back(stepRecord.m_eventWallTime);
+        stepRecord.m_nEventCalls = 0;
+        stepRecord.m_eventWallTime = 0.;
+    }
+
+    m_isEventOpen = false;
+    ++m_nEvents;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ReconstructionProfiler::AddMeasurement(
+    const std::string &stepName, const double wallTime, const MemoryUsage &startMemoryUsage, const MemoryUsage &endMemoryUsage)
+{
+    StepRecord &stepRecord(m_stepRecordMap[stepName]);
+    ++stepRecord.m_nEventCalls;
+    stepRecord.m_eventWallTime += wallTime;
+
+    if (!m_shouldRecordMemory)
+        return;
+
+    stepRecord.m_maxStartResidentSize = std::max(stepRecord.m_maxStartResidentSize, startMemoryUsage.m_residentSize);
+    stepRecord.m_maxEndResidentSize = std::max(stepRecord.m_maxEndResidentSize, endMemoryUsage.m_residentSize);
+    stepRecord.m_peakResidentSize = std::max(stepRecord.m_peakResidentSize, endMemoryUsage.m_peakResidentSize);
+
+    if (endMemoryUsage.m_residentSize > startMemoryUsage.m_residentSize)
+        stepRecord.m_maxResidentGrowth = std::max(stepRecord.m_maxResidentGrowth, endMemoryUsage.m_residentSize - startMemoryUsage.m_residentSize);
+
+    if (endMemoryUsage.m_peakResidentSize > startMemoryUsage.m_peakResidentSize)
+        ++stepRecord.m_nPeakRaises;
+
+    stepRecord.m_nArenaAllocations += endMemoryUsage.m_nArenaAllocations - startMemoryUsage.m_nArenaAllocations;
+    stepRecord.m_nArenaOverflows += endMemoryUsage.m_nArenaOverflowAllocations - startMemoryUsage.m_nArenaOverflowAllocations;
+    stepRecord.m_nArenaBufferGrowths += endMemoryUsage.m_nArenaBufferAllocations - startMemoryUsage.m_nArenaBufferAllocations;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ReconstructionProfiler::MemoryUsage ReconstructionProfiler::GetMemoryUsage() const
+{
+    MemoryUsage memoryUsage;
+
+    if (!m_shouldRecordMemory)
+        return memoryUsage;
+
+    // ATTN Arena counts are cumulative for the current thread, so the counts for a step are the differences between its start and end
+    memoryUsage.m_nArenaAllocations = EventArena::GetNAllocations();
+    memoryUsage.m_nArenaOverflowAllocations = EventArena::GetNOverflowAllocations();
+    memoryUsage.m_nArenaBufferAllocations = EventArena::GetNBufferAllocations();
+
+    std::ifstream file("/proc/self/status");
+    std::string line;
+
+    while (std::getline(file, line))
+    {
+        if (0 == line.compare(0, 6, "VmRSS:"))
+            memoryUsage.m_residentSize = std::stoul(line.substr(6));
+
+        if (0 == line.compare(0, 6, "VmHWM:"))
+            memoryUsage.m_peakResidentSize = std::stoul(line.substr(6));
+    }
+
+    return memoryUsage;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ReconstructionProfiler::WriteReport(const std::string &fileName)
+{
+    this->EndEvent();
+
+    std::ofstream file(fileName, std::ios::out | std::ios::trunc);
+
+    if (!file.is_open())
+    {
+        std::cout << "ReconstructionProfiler: Unable to open file " << fileName << std::endl;
+        return false;
+    }
+
+    file << "Step,NJobEvents,NEvents,NCalls,TotalWallTime,MeanEventWallTime,MedianEventWallTime,P90EventWallTime,P99EventWallTime,MaxEventWallTime"
+         << std::endl;
+
+    for (const StepRecordMap::value_type &mapEntry : m_stepRecordMap)
+    {
+        const StepRecord &stepRecord(mapEntry.second);
+
+        if (stepRecord.m_eventWallTimes.empty())
+            continue;
+
+        std::vector<double> sortedWallTimes(stepRecord.m_eventWallTimes);
+        std::sort(sortedWallTimes.begin(), sortedWallTimes.end());
+
+        double totalWallTime(0.);
+        for (const double wallTime : sortedWallTimes)
+            totalWallTime += wallTime;
+
+        file << mapEntry.first << "," << m_nEvents << "," << sortedWallTimes.size() << "," << stepRecord.m_nCalls << "," << totalWallTime << ","
+             << totalWallTime / static_cast<double>(sortedWallTimes.size()) << "," << ReconstructionProfiler::GetPercentile(sortedWallTimes, 50.)
+             << "," << ReconstructionProfiler::GetPercentile(sortedWallTimes, 90.) << ","
+             << ReconstructionProfiler::GetPercentile(sortedWallTimes, 99.) << "," << sortedWallTimes.back() << std::endl;
+    }
+
+    if (!file.good())
+    {
+        std::cout << "ReconstructionProfiler: Error writing report to file " << fileName << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ReconstructionProfiler::WriteMemoryReport(const std::string &fileName) const
+{
+    std::ofstream file(fileName, std::ios::out | std::ios::trunc);
+
+    if (!file.is_open())
+    {
+        std::cout << "ReconstructionProfiler: Unable to open file " << fileName << std::endl;
+        return false;
+    }
+
+    file << "Step,NCalls,MaxStartResidentSizeKB,MaxEndResidentSizeKB,MaxResidentGrowthKB,PeakResidentSizeKB,NPeakRaises,NArenaAllocations,"
+         << "NArenaOverflowAllocations,NArenaBufferAllocations" << std::endl;
+
+    for (const StepRecordMap::value_type &mapEntry : m_stepRecordMap)
+    {
+        const StepRecord &stepRecord(mapEntry.second);
+
+        file << mapEntry.first << "," << (stepRecord.m_nCalls + stepRecord.m_nEventCalls) << "," << stepRecord.m_maxStartResidentSize << ","
+             << stepRecord.m_maxEndResidentSize << "," << stepRecord.m_maxResidentGrowth << "," << stepRecord.m_peakResidentSize << ","
+             << stepRecord.m_nPeakRaises << "," << stepRecord.m_nArenaAllocations << "," << stepRecord.m_nArenaOverflows << ","
+             << stepRecord.m_nArenaBufferGrowths << std::endl;
+    }
+
+    if (!file.good())
+    {
+        std::cout << "ReconstructionProfiler: Error writing memory report to file " << fileName << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double ReconstructionProfiler::GetPercentile(const std::vector<double> &sortedValues, const double percentile)
+{
+    if (sortedValues.empty())
+        return 0.;
+
+    const double rank(std::ceil(0.01 * percentile * static_cast<double>(sortedValues.size())));
+    const std::size_t index(static_cast<std::size_t>(std::max(1., rank)) - 1);
+
+    return sortedValues.at(std::min(index, sortedValues.size() - 1));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ReconstructionProfiler::MemoryUsage::MemoryUsage() :
+    m_residentSize(0),
+    m_peakResidentSize(0),
+    m_nArenaAllocations(0),
+    m_nArenaOverflowAllocations(0),
+    m_nArenaBufferAllocations(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ReconstructionProfiler::StepRecord::StepRecord() :
+    m_nEventCalls(0),
+    m_eventWallTime(0.),
+    m_nCalls(0),
+    m_maxStartResidentSize(0),
+    m_maxEndResidentSize(0),
+    m_maxResidentGrowth(0),
+    m_peakResidentSize(0),
+    m_nPeakRaises(0),
+    m_nArenaAllocations(0),
+    m_nArenaOverflows(0),
+    m_nArenaBufferGrowths(0)
+{
+}
+
+} // namespace lar_content
@@ -0,0 +1,202 @@
+/**
+ *  @file   larpandoracontent/LArControlFlow/ReconstructionProfiler.h
+ *
+ *  @brief  Header file for the reconstruction profiler class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_RECONSTRUCTION_PROFILER_H
+#define LAR_RECONSTRUCTION_PROFILER_H 1
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ReconstructionProfiler class. Accumulates the wall time and call count of named reconstruction steps (master algorithm stages,
+ *          worker instance event processing, algorithm tool calls) for each event, and summarises the per-event totals over a job. Can
+ *          optionally sample the process memory usage and the event arena allocation counts at the start and end of each step, to summarise
+ *          the memory high-water mark and arena usage by step.
+ */
+class ReconstructionProfiler
+{
+public:
+    /**
+     *  @brief  MemoryUsage class
+     */
+    class MemoryUsage
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        MemoryUsage();
+
+        std::size_t m_residentSize;              ///< The resident set size, in kB
+        std::size_t m_peakResidentSize;          ///< The peak resident set size of the process so far, in kB
+        std::size_t m_nArenaAllocations;         ///< The number of event arena allocations on the current thread so far
+        std::size_t m_nArenaOverflowAllocations; ///< The number of event arena allocations served by the heap on the current thread so far
+        std::size_t m_nArenaBufferAllocations;   ///< The number of event arena buffer growths on the current thread so far
+    };
+
+    /**
+     *  @brief  ScopedTimer class, adding the wall time (and memory usage, if enabled) between its construction and destruction to a named step
+     */
+    class ScopedTimer
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pProfiler the address of the profiler, nullptr to disable timing
+         *  @param  stepName the step name
+         */
+        ScopedTimer(ReconstructionProfiler *const pProfiler, const std::string &stepName);
+
+        /**
+         *  @brief  Destructor, recording the elapsed wall time and memory usage
+         */
+        ~ScopedTimer();
+
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    private:
+        ReconstructionProfiler *const m_pProfiler;               ///< The address of the profiler, nullptr if timing is disabled
+        const std::string m_stepName;                            ///< The step name
+        const MemoryUsage m_startMemoryUsage;                    ///< The memory usage at the start
+        const std::chrono::steady_clock::time_point m_startTime; ///< The start time
+    };
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  shouldRecordMemory whether to sample the process memory usage at the start and end of each step
+     */
+    ReconstructionProfiler(const bool shouldRecordMemory = false);
+
+    /**
+     *  @brief  Start a new event, closing the current event if one is open
+     */
+    void StartEvent();
+
+    /**
+     *  @brief  Close the current event, adding its per-step totals to the job summary
+     */
+    void EndEvent();
+
+    /**
+     *  @brief  Add a measurement to a named step in the current event
+     *
+     *  @param  stepName the step name
+     *  @param  wallTime the wall time, in seconds
+     *  @param  startMemoryUsage the memory usage at the start of the step
+     *  @param  endMemoryUsage the memory usage at the end of the step
+     */
+    void AddMeasurement(const std::string &stepName, const double wallTime, const MemoryUsage &startMemoryUsage = MemoryUsage(),
+        const MemoryUsage &endMemoryUsage = MemoryUsage());
+
+    /**
+     *  @brief  Get the current memory usage of the process, if memory recording is enabled and supported (via /proc/self/status), together
+     *          with the event arena allocation counts for the current thread
+     *
+     *  @return the memory usage, zero if not recorded
+     */
+    MemoryUsage GetMemoryUsage() const;
+
+    /**
+     *  @brief  Write the job summary as a csv report, one row per step, closing the current event if one is open. For each step the
+     *          report lists the number of events and calls, the total wall time and the mean, median, 90th, 99th percentile and maximum
+     *          of the per-event wall time, in seconds.
+     *
+     *  @param  fileName the report file name
+     *
+     *  @return whether the report was written successfully
+     */
+    bool WriteReport(const std::string &fileName);
+
+    /**
+     *  @brief  Write the memory accounting summary as a csv report, one row per step. For each step the report lists the number of calls,
+     *          the maximum resident set size at the start and end of the step, the maximum growth in resident set size during the step,
+     *          the process high-water mark observed at the end of the step and the number of calls that raised the high-water mark, in kB,
+     *          followed by the number of event arena allocations, heap-served arena allocations and arena buffer growths during the calls.
+     *
+     *  @param  fileName the report file name
+     *
+     *  @return whether the report was written successfully
+     */
+    bool WriteMemoryReport(const std::string &fileName) const;
+
+private:
+    /**
+     *  @brief  StepRecord class
+     */
+    class StepRecord
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        StepRecord();
+
+        unsigned int m_nEventCalls;           ///< The number of calls in the current event
+        double m_eventWallTime;               ///< The total wall time in the current event
+        unsigned int m_nCalls;                ///< The number of calls in all closed events
+        std::vector<double> m_eventWallTimes; ///< The total wall time in each closed event in which the step was called
+        std::size_t m_maxStartResidentSize;   ///< The maximum resident set size at the start of a call, in kB
+        std::size_t m_maxEndResidentSize;     ///< The maximum resident set size at the end of a call, in kB
+        std::size_t m_maxResidentGrowth;      ///< The maximum growth in resident set size during a call, in kB
+        std::size_t m_peakResidentSize;       ///< The maximum process high-water mark at the end of a call, in kB
+        unsigned int m_nPeakRaises;           ///< The number of calls during which the process high-water mark was raised
+        std::size_t m_nArenaAllocations;      ///< The number of event arena allocations during calls
+        std::size_t m_nArenaOverflows;        ///< The number of event arena allocations served by the heap during calls
+        std::size_t m_nArenaBufferGrowths;    ///< The number of event arena buffer growths during calls
+    };
+
+    typedef std::map<std::string, StepRecord> StepRecordMap;
+
+    /**
+     *  @brief  Get a percentile of a sorted vector of values, using the nearest-rank method
+     *
+     *  @param  sortedValues the sorted values
+     *  @param  percentile the percentile, in the range [0, 100]
+     *
+     *  @return the percentile value
+     */
+    static double GetPercentile(const std::vector<double> &sortedValues, const double percentile);
+
+    StepRecordMap m_stepRecordMap; ///< The step records, ordered by step name
+    bool m_isEventOpen;            ///< Whether an event is currently open
+    unsigned int m_nEvents;        ///< The number of closed events
+    bool m_shouldRecordMemory;     ///< Whether to sample the process memory usage at the start and end of each step
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline ReconstructionProfiler::ScopedTimer::ScopedTimer(ReconstructionProfiler *const pProfiler, const std::string &stepName) :
+    m_pProfiler(pProfiler),
+    m_stepName(pProfiler ? stepName : std::string()),
+    m_startMemoryUsage(pProfiler ? pProfiler->GetMemoryUsage() : MemoryUsage()),
+    m_startTime(pProfiler ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline ReconstructionProfiler::ScopedTimer::~ScopedTimer()
+{
+    if (!m_pProfiler)
+        return;
+
+    const double wallTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - m_startTime).count());
+    m_pProfiler->AddMeasurement(m_stepName, wallTime, m_startMemoryUsage, m_pProfiler->GetMemoryUsage());
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_RECONSTRUCTION_PROFILER_H
@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArStitchingHelper.h"
@@ -35,7 +36,8 @@ StitchingCosmicRayMergingTool::StitchingCosmicRayMergingTool() :
     m_relaxTransverseDisplacement(2.5f),
     m_minNCaloHits3D(0),
     m_maxX0FractionalDeviation(0.3f),
-    m_boundaryToleranceWidth(10.f)
+    m_boundaryToleranceWidth(10.f),
+    m_nMatchingThreads(1)
 {
 }
 
@@ -147,32 +149,68 @@ void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPCToPfoMap &larTP
         larTPCVector.push_back(mapEntry.first);
     std::sort(larTPCVector.begin(), larTPCVector.end(), LArStitchingHelper::SortTPCs);
 
+    LArTPCPairVector larTPCPairVector;
+
     for (LArTPCVector::const_iterator tpcIter1 = larTPCVector.begin(), tpcIterEnd = larTPCVector.end(); tpcIter1 != tpcIterEnd; ++tpcIter1)
     {
-        const LArTPC *const pLArTPC1(*tpcIter1);
-        const PfoList &pfoList1(larTPCToPfoMap.at(pLArTPC1));
-
         for (LArTPCVector::const_iterator tpcIter2 = tpcIter1; tpcIter2 != tpcIterEnd; ++tpcIter2)
         {
-            const LArTPC *const pLArTPC2(*tpcIter2);
-            const PfoList &pfoList2(larTPCToPfoMap.at(pLArTPC2));
+            if (LArStitchingHelper::CanTPCsBeStitched(**tpcIter1, **tpcIter2))
+                larTPCPairVector.emplace_back(*tpcIter1, *tpcIter2);
+        }
+    }
 
-            if (!LArStitchingHelper::CanTPCsBeStitched(*pLArTPC1, *pLArTPC2))
-                continue;
+    // ATTN Each pair of tpcs is matched independently, then associations are added to the matrix in the same order as a serial search
+    std::vector<PfoAssociationList> pfoAssociationLists(larTPCPairVector.size());
 
-            for (const ParticleFlowObject *const pPfo1 : pfoList1)
-            {
-                for (const ParticleFlowObject *const pPfo2 : pfoList2)
-                    this->CreatePfoMatches(*pLArTPC1, *pLArTPC2, pPfo1, pPfo2, pointingClusterMap, pfoAssociationMatrix);
-            }
-        }
+    LArParallelHelper::ForEachIndex(larTPCPairVector.size(), m_nMatchingThreads, [&](const std::size_t index) {
+        const LArTPC *const pLArTPC1(larTPCPairVector.at(index).first);
+        const LArTPC *const pLArTPC2(larTPCPairVector.at(index).second);
+        this->CreatePfoMatches(*pLArTPC1, *pLArTPC2, larTPCToPfoMap.at(pLArTPC1), larTPCToPfoMap.at(pLArTPC2), pointingClusterMap,
+            pfoAssociationLists.at(index));
+    });
+
+    for (const PfoAssociationList &pfoAssociationList : pfoAssociationLists)
+    {
+        for (const PfoAssociationList::value_type &association : pfoAssociationList)
+            pfoAssociationMatrix[association.first.first].insert(PfoAssociationMap::value_type(association.first.second, association.second));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPC &larTPC1, const LArTPC &larTPC2, const PfoList &pfoList1,
+    const PfoList &pfoList2, const ThreeDPointingClusterMap &pointingClusterMap, PfoAssociationList &pfoAssociationList) const
+{
+    const float boundaryWidthX(LArStitchingHelper::GetTPCBoundaryWidthX(larTPC1, larTPC2));
+    const float maxLongitudinalDisplacementX(m_maxLongitudinalDisplacementX + boundaryWidthX);
+
+    ProjectedVertexVector projectedVertices1, projectedVertices2;
+    this->GetProjectedVertices(pfoList1, pointingClusterMap, maxLongitudinalDisplacementX, projectedVertices1);
+    this->GetProjectedVertices(pfoList2, pointingClusterMap, maxLongitudinalDisplacementX, projectedVertices2);
+
+    // ATTN An associated pair satisfies the displacement requirement for at least one of its vertices, so search in both directions
+    IndexPairVector candidatePairs;
+    this->AddCandidatePairs(projectedVertices1, projectedVertices2, true, candidatePairs);
+    this->AddCandidatePairs(projectedVertices2, projectedVertices1, false, candidatePairs);
+
+    std::sort(candidatePairs.begin(), candidatePairs.end());
+    candidatePairs.erase(std::unique(candidatePairs.begin(), candidatePairs.end()), candidatePairs.end());
+
+    const PfoVector pfoVector1(pfoList1.begin(), pfoList1.end());
+    const PfoVector pfoVector2(pfoList2.begin(), pfoList2.end());
+
+    for (const IndexPair &candidatePair : candidatePairs)
+    {
+        this->CreatePfoMatches(
+            larTPC1, larTPC2, pfoVector1.at(candidatePair.first), pfoVector2.at(candidatePair.second), pointingClusterMap, pfoAssociationList);
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPC &larTPC1, const LArTPC &larTPC2, const ParticleFlowObject *const pPfo1,
-    const ParticleFlowObject *const pPfo2, const ThreeDPointingClusterMap &pointingClusterMap, PfoAssociationMatrix &pfoAssociationMatrix) const
+    const ParticleFlowObject *const pPfo2, const ThreeDPointingClusterMap &pointingClusterMap, PfoAssociationList &pfoAssociationList) const
 {
     // Get centre and width of boundary between tpcs
     const float boundaryCenterX(LArStitchingHelper::GetTPCBoundaryCenterX(larTPC1, larTPC2));
@@ -282,8 +320,97 @@ void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPC &larTPC1, cons
     const float particleLength1(pointingCluster1.GetLengthSquared());
     const float particleLength2(pointingCluster2.GetLengthSquared());
 
-    pfoAssociationMatrix[pPfo1].insert(PfoAssociationMap::value_type(pPfo2, PfoAssociation(vertexType1, vertexType2, particleLength2)));
-    pfoAssociationMatrix[pPfo2].insert(PfoAssociationMap::value_type(pPfo1, PfoAssociation(vertexType2, vertexType1, particleLength1)));
+    pfoAssociationList.emplace_back(PfoPair(pPfo1, pPfo2), PfoAssociation(vertexType1, vertexType2, particleLength2));
+    pfoAssociationList.emplace_back(PfoPair(pPfo2, pPfo1), PfoAssociation(vertexType2, vertexType1, particleLength1));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StitchingCosmicRayMergingTool::GetProjectedVertices(const PfoList &pfoList, const ThreeDPointingClusterMap &pointingClusterMap,
+    const float maxLongitudinalDisplacementX, ProjectedVertexVector &projectedVertices) const
+{
+    const PfoVector pfoVector(pfoList.begin(), pfoList.end());
+
+    for (unsigned int pfoIndex = 0; pfoIndex < pfoVector.size(); ++pfoIndex)
+    {
+        const ParticleFlowObject *const pPfo(pfoVector.at(pfoIndex));
+        ThreeDPointingClusterMap::const_iterator iter(pointingClusterMap.find(pPfo));
+
+        if ((pointingClusterMap.end() == iter) || (iter->second.GetLengthSquared() < m_minLengthSquared))
+            continue;
+
+        CaloHitList caloHitList3D;
+        LArPfoHelper::GetCaloHits(pPfo, TPC_3D, caloHitList3D);
+
+        if (caloHitList3D.size() < m_minNCaloHits3D)
+            continue;
+
+        for (const LArPointingCluster::Vertex *const pVertex : {&iter->second.GetInnerVertex(), &iter->second.GetOuterVertex()})
+        {
+            const float maxDisplacementYZ(this->GetMaxDisplacementYZ(*pVertex, maxLongitudinalDisplacementX));
+
+            if (maxDisplacementYZ < 0.f)
+                continue;
+
+            projectedVertices.emplace_back(*pVertex, maxDisplacementYZ, pfoIndex);
+        }
+    }
+
+    std::sort(projectedVertices.begin(), projectedVertices.end(),
+        [](const ProjectedVertex &lhs, const ProjectedVertex &rhs) { return (lhs.m_y < rhs.m_y); });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float StitchingCosmicRayMergingTool::GetMaxDisplacementYZ(const LArPointingCluster::Vertex &vertex, const float maxLongitudinalDisplacementX) const
+{
+    // Vertices with no x direction, or (for y-z impact parameters) no y-z direction, are never associated
+    const float pX(std::fabs(vertex.GetDirection().GetX()));
+
+    if ((pX < std::numeric_limits<float>::epsilon()) || (!m_useXcoordinate && (pX > 1.f - std::numeric_limits<float>::epsilon())))
+        return -1.f;
+
+    // ATTN The minimum longitudinal impact parameter depends on whether the pair of vertices is in a gap, so consider both values
+    float maxLongitudinalDisplacement(0.f);
+
+    for (const float minL : {-1.f, m_relaxMinLongitudinalDisplacement})
+    {
+        const float dXdL(m_useXcoordinate ? pX : (1.f - pX * pX > std::numeric_limits<float>::epsilon()) ? pX / std::sqrt(1.f - pX * pX) : minL);
+        const float maxL(std::max(std::fabs(minL), std::fabs(maxLongitudinalDisplacementX / dXdL)));
+        maxLongitudinalDisplacement = std::max(maxLongitudinalDisplacement, maxL);
+    }
+
+    // The y-z displacement is bounded by the impact parameters, with the transverse impact parameter below the looser of its two cuts
+    const float maxTransverseDisplacement(std::max(m_maxTransverseDisplacement, m_relaxTransverseDisplacement));
+    const float maxDisplacement(
+        std::sqrt(maxLongitudinalDisplacement * maxLongitudinalDisplacement + maxTransverseDisplacement * maxTransverseDisplacement));
+
+    // ATTN Small margin to absorb floating point rounding in the impact parameter calculation
+    return 1.01f * maxDisplacement + std::numeric_limits<float>::epsilon();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StitchingCosmicRayMergingTool::AddCandidatePairs(const ProjectedVertexVector &queryVertices, const ProjectedVertexVector &sortedVertices,
+    const bool isQueryFirst, IndexPairVector &candidatePairs) const
+{
+    for (const ProjectedVertex &queryVertex : queryVertices)
+    {
+        const float maxDisplacementYZ(queryVertex.m_maxDisplacementYZ);
+        ProjectedVertexVector::const_iterator iter(std::lower_bound(sortedVertices.begin(), sortedVertices.end(),
+            queryVertex.m_y - maxDisplacementYZ, [](const ProjectedVertex &projectedVertex, const float y) { return (projectedVertex.m_y < y); }));
+
+        for (; (sortedVertices.end() != iter) && (iter->m_y <= queryVertex.m_y + maxDisplacementYZ); ++iter)
+        {
+            const float dY(iter->m_y - queryVertex.m_y), dZ(iter->m_z - queryVertex.m_z);
+
+            if (dY * dY + dZ * dZ > maxDisplacementYZ * maxDisplacementYZ)
+                continue;
+
+            candidatePairs.push_back(
+                isQueryFirst ? IndexPair(queryVertex.m_pfoIndex, iter->m_pfoIndex) : IndexPair(iter->m_pfoIndex, queryVertex.m_pfoIndex));
+        }
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -815,6 +942,18 @@ float StitchingCosmicRayMergingTool::PfoAssociation::GetFigureOfMerit() const
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StitchingCosmicRayMergingTool::ProjectedVertex::ProjectedVertex(
+    const LArPointingCluster::Vertex &vertex, const float maxDisplacementYZ, const unsigned int pfoIndex) :
+    m_y(vertex.GetPosition().GetY()),
+    m_z(vertex.GetPosition().GetZ()),
+    m_maxDisplacementYZ(maxDisplacementYZ),
+    m_pfoIndex(pfoIndex)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode StitchingCosmicRayMergingTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -856,6 +995,9 @@ StatusCode StitchingCosmicRayMergingTool::ReadSettings(const TiXmlHandle xmlHand
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "BoundaryToleranceWidth", m_boundaryToleranceWidth));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NMatchingThreads", m_nMatchingThreads));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -13,6 +13,8 @@
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace lar_content
 {
@@ -131,6 +133,25 @@ private:
     void CreatePfoMatches(const LArTPCToPfoMap &larTPCToPfoMap, const ThreeDPointingClusterMap &pointingClusterMap,
         PfoAssociationMatrix &pfoAssociationMatrix) const;
 
+    typedef std::pair<const pandora::ParticleFlowObject *, const pandora::ParticleFlowObject *> PfoPair;
+    typedef std::vector<std::pair<PfoPair, PfoAssociation>> PfoAssociationList;
+    typedef std::vector<std::pair<const pandora::LArTPC *, const pandora::LArTPC *>> LArTPCPairVector;
+    typedef std::pair<unsigned int, unsigned int> IndexPair;
+    typedef std::vector<IndexPair> IndexPairVector;
+
+    /**
+     *  @brief  Create associations between the Pfos in a pair of tpcs, considering only candidate pairs with nearby vertices
+     *
+     *  @param  larTPC1 the tpc description for the first list of Pfos
+     *  @param  larTPC2 the tpc description for the second list of Pfos
+     *  @param  pfoList1 the Pfos in the first tpc
+     *  @param  pfoList2 the Pfos in the second tpc
+     *  @param  pointingClusterMap the input mapping between Pfos and their corresponding 3D pointing clusters
+     *  @param  pfoAssociationList to receive the associations between Pfos, in the order in which they were found
+     */
+    void CreatePfoMatches(const pandora::LArTPC &larTPC1, const pandora::LArTPC &larTPC2, const pandora::PfoList &pfoList1,
+        const pandora::PfoList &pfoList2, const ThreeDPointingClusterMap &pointingClusterMap, PfoAssociationList &pfoAssociationList) const;
+
     /**
      *  @brief  Create associations between Pfos using 3D pointing clusters
      *
@@ -139,11 +160,68 @@ private:
      *  @param  pPfo1 the first Pfo
      *  @param  pPfo2 the second Pfo
      *  @param  pointingClusterMap the input mapping between Pfos and their corresponding 3D pointing clusters
-     *  @param  pfoAssociationMatrix the output matrix of associations between Pfos
+     *  @param  pfoAssociationList to receive the associations between Pfos
      */
     void CreatePfoMatches(const pandora::LArTPC &larTPC1, const pandora::LArTPC &larTPC2, const pandora::ParticleFlowObject *const pPfo1,
         const pandora::ParticleFlowObject *const pPfo2, const ThreeDPointingClusterMap &pointingClusterMap,
-        PfoAssociationMatrix &pfoAssociationMatrix) const;
+        PfoAssociationList &pfoAssociationList) const;
+
+    /**
+     *  @brief  ProjectedVertex class, the y-z projection of a pointing cluster vertex, with the maximum y-z displacement between it
+     *          and the vertex of any Pfo with which it could be associated
+     */
+    class ProjectedVertex
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  vertex the pointing cluster vertex
+         *  @param  maxDisplacementYZ the maximum y-z displacement for association
+         *  @param  pfoIndex the index of the parent Pfo in its tpc Pfo list
+         */
+        ProjectedVertex(const LArPointingCluster::Vertex &vertex, const float maxDisplacementYZ, const unsigned int pfoIndex);
+
+        float m_y;                 ///< The vertex y coordinate
+        float m_z;                 ///< The vertex z coordinate
+        float m_maxDisplacementYZ; ///< The maximum y-z displacement for association
+        unsigned int m_pfoIndex;   ///< The index of the parent Pfo in its tpc Pfo list
+    };
+
+    typedef std::vector<ProjectedVertex> ProjectedVertexVector;
+
+    /**
+     *  @brief  Get the y-z projected vertices of the Pfos in a tpc that could be associated with Pfos in a neighbouring tpc, sorted by y
+     *
+     *  @param  pfoList the Pfos in the tpc
+     *  @param  pointingClusterMap the input mapping between Pfos and their corresponding 3D pointing clusters
+     *  @param  maxLongitudinalDisplacementX the maximum longitudinal displacement, in x, for the tpc boundary
+     *  @param  projectedVertices to receive the projected vertices
+     */
+    void GetProjectedVertices(const pandora::PfoList &pfoList, const ThreeDPointingClusterMap &pointingClusterMap,
+        const float maxLongitudinalDisplacementX, ProjectedVertexVector &projectedVertices) const;
+
+    /**
+     *  @brief  Get the maximum y-z displacement between a pointing cluster vertex and the vertex of any Pfo with which it could be
+     *          associated, following from the longitudinal and transverse impact parameter requirements
+     *
+     *  @param  vertex the pointing cluster vertex
+     *  @param  maxLongitudinalDisplacementX the maximum longitudinal displacement, in x, for the tpc boundary
+     *
+     *  @return the maximum y-z displacement, negative if the vertex cannot be associated
+     */
+    float GetMaxDisplacementYZ(const LArPointingCluster::Vertex &vertex, const float maxLongitudinalDisplacementX) const;
+
+    /**
+     *  @brief  Add the candidate pairs for which a projected vertex lies within the maximum y-z displacement of a query vertex
+     *
+     *  @param  queryVertices the query projected vertices
+     *  @param  sortedVertices the projected vertices to search, sorted by y
+     *  @param  isQueryFirst whether the query vertices belong to the first tpc of the pair
+     *  @param  candidatePairs to receive the candidate pairs of indices, first tpc index then second tpc index
+     */
+    void AddCandidatePairs(const ProjectedVertexVector &queryVertices, const ProjectedVertexVector &sortedVertices, const bool isQueryFirst,
+        IndexPairVector &candidatePairs) const;
 
     typedef std::unordered_map<const pandora::ParticleFlowObject *, pandora::PfoList> PfoMergeMap;
 
@@ -241,6 +319,7 @@ private:
     unsigned int m_minNCaloHits3D;
     float m_maxX0FractionalDeviation; ///< The maximum allowed fractional difference of an X0 contribution for matches to be stitched
     float m_boundaryToleranceWidth;   ///< The distance from the APA/CPA boundary inside which the deviation consideration is ignored
+    unsigned int m_nMatchingThreads;  ///< The number of threads used to match Pfos between pairs of tpcs, zero to use the hardware concurrency
 };
 
 } // namespace lar_content
@@ -443,105 +443,36 @@ void LArClusterHelper::GetExtremalCoordinates(const OrderedCaloHitList &orderedC
 
 void LArClusterHelper::GetExtremalCoordinates(const CartesianPointVector &coordinateVector, CartesianVector &innerCoordinate, CartesianVector &outerCoordinate)
 {
-    if (coordinateVector.empty())
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
-
-    // Find the extremal values of the X, Y and Z coordinates
-    float xMin(+std::numeric_limits<float>::max());
-    float yMin(+std::numeric_limits<float>::max());
-    float zMin(+std::numeric_limits<float>::max());
-    float xMax(-std::numeric_limits<float>::max());
-    float yMax(-std::numeric_limits<float>::max());
-    float zMax(-std::numeric_limits<float>::max());
-
-    for (CartesianPointVector::const_iterator pIter = coordinateVector.begin(), pIterEnd = coordinateVector.end(); pIter != pIterEnd; ++pIter)
-    {
-        const CartesianVector &pos = *pIter;
-        xMin = std::min(pos.GetX(), xMin);
-        xMax = std::max(pos.GetX(), xMax);
-        yMin = std::min(pos.GetY(), yMin);
-        yMax = std::max(pos.GetY(), yMax);
-        zMin = std::min(pos.GetZ(), zMin);
-        zMax = std::max(pos.GetZ(), zMax);
-    }
-
-    // Choose the coordinate with the greatest span (keeping any ties)
-    const float xAve(0.5f * (xMin + xMax));
-    const float yAve(0.5f * (yMin + yMax));
-    const float zAve(0.5f * (zMin + zMax));
-
-    const float xSpan(xMax - xMin);
-    const float ySpan(yMax - yMin);
-    const float zSpan(zMax - zMin);
-
-    const bool useX((xSpan > std::numeric_limits<float>::epsilon()) && (xSpan + std::numeric_limits<float>::epsilon() > std::max(ySpan, zSpan)));
-    const bool useY((ySpan > std::numeric_limits<float>::epsilon()) && (ySpan + std::numeric_limits<float>::epsilon() > std::max(zSpan, xSpan)));
-    const bool useZ((zSpan > std::numeric_limits<float>::epsilon()) && (zSpan + std::numeric_limits<float>::epsilon() > std::max(xSpan, ySpan)));
-
-    // Find the extremal hits separately for the chosen coordinates
-    CartesianPointVector candidateVector;
-
-    for (CartesianPointVector::const_iterator pIter = coordinateVector.begin(), pIterEnd = coordinateVector.end(); pIter != pIterEnd; ++pIter)
+    /**
+     *  @brief  CoordinateAccessor class, giving indexed access to the components of the provided coordinates
+     */
+    class CoordinateAccessor
     {
-        const CartesianVector &pos = *pIter;
-
-        if (useX)
+    public:
+        CoordinateAccessor(const CartesianPointVector &coordinateVector) : m_coordinateVector(coordinateVector)
         {
-            if (((pos.GetX() - xMin) < std::numeric_limits<float>::epsilon()) || ((pos.GetX() - xMax) > -std::numeric_limits<float>::epsilon()))
-                candidateVector.push_back(pos);
         }
 
-        if (useY)
+        float GetX(const unsigned int index) const
         {
-            if (((pos.GetY() - yMin) < std::numeric_limits<float>::epsilon()) || ((pos.GetY() - yMax) > -std::numeric_limits<float>::epsilon()))
-                candidateVector.push_back(pos);
+            return m_coordinateVector[index].GetX();
         }
 
-        if (useZ)
+        float GetY(const unsigned int index) const
         {
-            if (((pos.GetZ() - zMin) < std::numeric_limits<float>::epsilon()) || ((pos.GetZ() - zMax) > -std::numeric_limits<float>::epsilon()))
-                candidateVector.push_back(pos);
+            return m_coordinateVector[index].GetY();
         }
-    }
 
-    // Finally, find the pair of hits that are separated by the greatest distance
-    CartesianVector firstCoordinate(xAve, yAve, zAve);
-    CartesianVector secondCoordinate(xAve, yAve, zAve);
-    float maxDistanceSquared(+std::numeric_limits<float>::epsilon());
-
-    for (CartesianPointVector::const_iterator iterI = candidateVector.begin(), iterEndI = candidateVector.end(); iterI != iterEndI; ++iterI)
-    {
-        const CartesianVector &posI = *iterI;
-
-        for (CartesianPointVector::const_iterator iterJ = iterI, iterEndJ = candidateVector.end(); iterJ != iterEndJ; ++iterJ)
+        float GetZ(const unsigned int index) const
         {
-            const CartesianVector &posJ = *iterJ;
-
-            const float distanceSquared((posI - posJ).GetMagnitudeSquared());
-
-            if (distanceSquared > maxDistanceSquared)
-            {
-                maxDistanceSquared = distanceSquared;
-                firstCoordinate = posI;
-                secondCoordinate = posJ;
-            }
+            return m_coordinateVector[index].GetZ();
         }
-    }
 
-    // Set the inner and outer coordinates (Check Z first, then X in the event of a tie)
-    const float deltaZ(secondCoordinate.GetZ() - firstCoordinate.GetZ());
-    const float deltaX(secondCoordinate.GetX() - firstCoordinate.GetX());
+    private:
+        const CartesianPointVector &m_coordinateVector; ///< The coordinate vector
+    };
 
-    if ((deltaZ > 0.f) || ((std::fabs(deltaZ) < std::numeric_limits<float>::epsilon()) && (deltaX > 0.f)))
-    {
-        innerCoordinate = firstCoordinate;
-        outerCoordinate = secondCoordinate;
-    }
-    else
-    {
-        innerCoordinate = secondCoordinate;
-        outerCoordinate = firstCoordinate;
-    }
+    LArClusterHelper::GetExtremalCoordinates(coordinateVector.size(), CoordinateAccessor(coordinateVector), innerCoordinate, outerCoordinate);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -10,6 +10,11 @@
 
 #include "Objects/Cluster.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -246,6 +251,18 @@ public:
     static void GetExtremalCoordinates(const pandora::CartesianPointVector &coordinateVector, pandora::CartesianVector &innerCoordinate,
         pandora::CartesianVector &outerCoordinate);
 
+    /**
+     *  @brief  Get positions of the two most distant points in an indexed set of points (ordered by Z)
+     *
+     *  @param  nPoints the number of points
+     *  @param  positionAccessor the position accessor, providing GetX, GetY and GetZ for each point index
+     *  @param  the inner extremal position
+     *  @param  the outer extremal position
+     */
+    template <typename T>
+    static void GetExtremalCoordinates(const unsigned int nPoints, const T &positionAccessor, pandora::CartesianVector &innerCoordinate,
+        pandora::CartesianVector &outerCoordinate);
+
     /**
      *  @brief  Get minimum and maximum X, Y and Z positions of the calo hits in a cluster
      *
@@ -376,6 +393,101 @@ public:
     static bool SortCoordinatesByPosition(const pandora::CartesianVector &lhs, const pandora::CartesianVector &rhs);
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void LArClusterHelper::GetExtremalCoordinates(
+    const unsigned int nPoints, const T &positionAccessor, pandora::CartesianVector &innerCoordinate, pandora::CartesianVector &outerCoordinate)
+{
+    if (0 == nPoints)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
+
+    // Find the extremal values of the X, Y and Z coordinates
+    float xMin(+std::numeric_limits<float>::max());
+    float yMin(+std::numeric_limits<float>::max());
+    float zMin(+std::numeric_limits<float>::max());
+    float xMax(-std::numeric_limits<float>::max());
+    float yMax(-std::numeric_limits<float>::max());
+    float zMax(-std::numeric_limits<float>::max());
+
+    for (unsigned int i = 0; i < nPoints; ++i)
+    {
+        xMin = std::min(positionAccessor.GetX(i), xMin);
+        xMax = std::max(positionAccessor.GetX(i), xMax);
+        yMin = std::min(positionAccessor.GetY(i), yMin);
+        yMax = std::max(positionAccessor.GetY(i), yMax);
+        zMin = std::min(positionAccessor.GetZ(i), zMin);
+        zMax = std::max(positionAccessor.GetZ(i), zMax);
+    }
+
+    // Choose the coordinate with the greatest span (keeping any ties)
+    const float epsilon(std::numeric_limits<float>::epsilon());
+    const float xSpan(xMax - xMin);
+    const float ySpan(yMax - yMin);
+    const float zSpan(zMax - zMin);
+
+    const bool useX((xSpan > epsilon) && (xSpan + epsilon > std::max(ySpan, zSpan)));
+    const bool useY((ySpan > epsilon) && (ySpan + epsilon > std::max(zSpan, xSpan)));
+    const bool useZ((zSpan > epsilon) && (zSpan + epsilon > std::max(xSpan, ySpan)));
+
+    // Find the extremal points separately for the chosen coordinates
+    std::vector<unsigned int> candidateIndices;
+
+    for (unsigned int i = 0; i < nPoints; ++i)
+    {
+        if (useX && (((positionAccessor.GetX(i) - xMin) < epsilon) || ((positionAccessor.GetX(i) - xMax) > -epsilon)))
+            candidateIndices.push_back(i);
+
+        if (useY && (((positionAccessor.GetY(i) - yMin) < epsilon) || ((positionAccessor.GetY(i) - yMax) > -epsilon)))
+            candidateIndices.push_back(i);
+
+        if (useZ && (((positionAccessor.GetZ(i) - zMin) < epsilon) || ((positionAccessor.GetZ(i) - zMax) > -epsilon)))
+            candidateIndices.push_back(i);
+    }
+
+    // Find the pair of points that are separated by the greatest distance
+    const pandora::CartesianVector averageCoordinate(0.5f * (xMin + xMax), 0.5f * (yMin + yMax), 0.5f * (zMin + zMax));
+    pandora::CartesianVector firstCoordinate(averageCoordinate);
+    pandora::CartesianVector secondCoordinate(averageCoordinate);
+    float maxDistanceSquared(+epsilon);
+
+    for (unsigned int i = 0; i < candidateIndices.size(); ++i)
+    {
+        const unsigned int indexI(candidateIndices[i]);
+
+        for (unsigned int j = i; j < candidateIndices.size(); ++j)
+        {
+            const unsigned int indexJ(candidateIndices[j]);
+            const float deltaX(positionAccessor.GetX(indexI) - positionAccessor.GetX(indexJ));
+            const float deltaY(positionAccessor.GetY(indexI) - positionAccessor.GetY(indexJ));
+            const float deltaZ(positionAccessor.GetZ(indexI) - positionAccessor.GetZ(indexJ));
+            const float distanceSquared(deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ);
+
+            if (distanceSquared > maxDistanceSquared)
+            {
+                maxDistanceSquared = distanceSquared;
+                firstCoordinate.SetValues(positionAccessor.GetX(indexI), positionAccessor.GetY(indexI), positionAccessor.GetZ(indexI));
+                secondCoordinate.SetValues(positionAccessor.GetX(indexJ), positionAccessor.GetY(indexJ), positionAccessor.GetZ(indexJ));
+            }
+        }
+    }
+
+    // Set the inner and outer coordinates (Check Z first, then X in the event of a tie)
+    const float deltaZ(secondCoordinate.GetZ() - firstCoordinate.GetZ());
+    const float deltaX(secondCoordinate.GetX() - firstCoordinate.GetX());
+
+    if ((deltaZ > 0.f) || ((std::fabs(deltaZ) < epsilon) && (deltaX > 0.f)))
+    {
+        innerCoordinate = firstCoordinate;
+        outerCoordinate = secondCoordinate;
+    }
+    else
+    {
+        innerCoordinate = secondCoordinate;
+        outerCoordinate = firstCoordinate;
+    }
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_CLUSTER_HELPER_H
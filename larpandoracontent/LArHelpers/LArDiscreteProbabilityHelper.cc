@@ -9,6 +9,8 @@
 
 #include "larpandoracontent/LArHelpers/LArDiscreteProbabilityHelper.h"
 
+#include <numeric>
+
 namespace lar_content
 {
 
@@ -16,20 +18,69 @@ template <typename T>
 float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
     const T &t1, const T &t2, std::mt19937 &randomNumberGenerator, const unsigned int nPermutations)
 {
+    bool isStoppedEarly(false);
+    return LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+        t1, t2, randomNumberGenerator, nPermutations, 1.f, isStoppedEarly);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(const T &t1, const T &t2,
+    std::mt19937 &randomNumberGenerator, const unsigned int nPermutations, const float pValueThreshold, bool &isStoppedEarly)
+{
+    isStoppedEarly = false;
+
     if (1 > nPermutations)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
 
     const float rNominal(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficient(t1, t2));
 
+    // ATTN Permuting a dataset changes neither its mean nor its variance, so only the covariance need be recalculated
+    const unsigned int size(LArDiscreteProbabilityHelper::GetSize(t1));
+    const float mean1(LArDiscreteProbabilityHelper::CalculateMean(t1));
+    const float mean2(LArDiscreteProbabilityHelper::CalculateMean(t2));
+
+    pandora::FloatVector diffs1, diffs2;
+    float variance1(0.f), variance2(0.f);
+
+    for (unsigned int iElement = 0; iElement < size; ++iElement)
+    {
+        diffs1.emplace_back(LArDiscreteProbabilityHelper::GetElement(t1, iElement) - mean1);
+        diffs2.emplace_back(LArDiscreteProbabilityHelper::GetElement(t2, iElement) - mean2);
+
+        variance1 += diffs1.back() * diffs1.back();
+        variance2 += diffs2.back() * diffs2.back();
+    }
+
+    const float sqrtVars(std::sqrt(variance1 * variance2));
+
+    std::vector<unsigned int> indices1(size), indices2(size);
     unsigned int nExtreme(0);
+
     for (unsigned int iPermutation = 0; iPermutation < nPermutations; ++iPermutation)
     {
-        const float rRandomised(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficient(
-            LArDiscreteProbabilityHelper::MakeRandomisedSample(t1, randomNumberGenerator),
-            LArDiscreteProbabilityHelper::MakeRandomisedSample(t2, randomNumberGenerator)));
+        // ATTN Shuffling the identity permutation uses the random number generator exactly as shuffling a copy of the dataset would
+        std::iota(indices1.begin(), indices1.end(), 0);
+        std::shuffle(indices1.begin(), indices1.end(), randomNumberGenerator);
+        std::iota(indices2.begin(), indices2.end(), 0);
+        std::shuffle(indices2.begin(), indices2.end(), randomNumberGenerator);
+
+        float covariance(0.f);
+
+        for (unsigned int iElement = 0; iElement < size; ++iElement)
+            covariance += diffs1[indices1[iElement]] * diffs2[indices2[iElement]];
 
-        if ((rRandomised - rNominal) > std::numeric_limits<float>::epsilon())
+        if ((covariance / sqrtVars - rNominal) > std::numeric_limits<float>::epsilon())
             nExtreme++;
+
+        // ATTN Compare the lower bound on the p-value, evaluated exactly as the returned p-value, so that rounding cannot stop a test whose
+        // final p-value would not exceed the threshold
+        if (static_cast<float>(nExtreme) / static_cast<float>(nPermutations) > pValueThreshold)
+        {
+            isStoppedEarly = (iPermutation + 1 < nPermutations);
+            break;
+        }
     }
 
     return static_cast<float>(nExtreme) / static_cast<float>(nPermutations);
@@ -47,7 +98,7 @@ float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromStu
     if (0 > dof)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
 
-    const float tTestStatisticDenominator(1.f - correlation - correlation);
+    const float tTestStatisticDenominator(1.f - correlation * correlation);
 
     if (tTestStatisticDenominator < std::numeric_limits<float>::epsilon())
         throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
@@ -128,6 +179,10 @@ template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPVal
     const DiscreteProbabilityVector &, const DiscreteProbabilityVector &, std::mt19937 &, const unsigned int);
 template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
     const pandora::FloatVector &, const pandora::FloatVector &, std::mt19937 &, const unsigned int);
+template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+    const DiscreteProbabilityVector &, const DiscreteProbabilityVector &, std::mt19937 &, const unsigned int, const float, bool &);
+template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+    const pandora::FloatVector &, const pandora::FloatVector &, std::mt19937 &, const unsigned int, const float, bool &);
 
 template float LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromStudentTDistribution(
     const DiscreteProbabilityVector &, const DiscreteProbabilityVector &, const unsigned int, const float);
@@ -23,7 +23,9 @@ class LArDiscreteProbabilityHelper
 {
 public:
     /**
-     *  @brief  Calculate P value for measured correlation coefficient between two datasets via a permutation test 
+     *  @brief  Calculate P value for measured correlation coefficient between two datasets via a permutation test. The datasets are
+     *          permuted in place, via shuffled index arrays, and the means and variances are evaluated only once, so that each
+     *          permutation costs a single dot product.
      *
      *  @param  t1 the first input dataset
      *  @param  t2 the second input dataset
@@ -36,6 +38,24 @@ public:
     static float CalculateCorrelationCoefficientPValueFromPermutationTest(
         const T &t1, const T &t2, std::mt19937 &randomNumberGenerator, const unsigned int nPermutations);
 
+    /**
+     *  @brief  Calculate P value for measured correlation coefficient between two datasets via a permutation test, as above, but stop
+     *          early once the p-value is certain to exceed a threshold. The returned p-value is then only a lower bound, so callers
+     *          should reject any test that was stopped early, rather than compare the returned p-value with their own cut.
+     *
+     *  @param  t1 the first input dataset
+     *  @param  t2 the second input dataset
+     *  @param  randomNumberGenerator the random number generator to shuffle the datasets
+     *  @param  nPermutations the number of permutations to run
+     *  @param  pValueThreshold the p-value threshold
+     *  @param  isStoppedEarly to receive whether the permutations were stopped early
+     *
+     *  @return the p-value, or a lower bound exceeding the threshold if stopped early
+     */
+    template <typename T>
+    static float CalculateCorrelationCoefficientPValueFromPermutationTest(const T &t1, const T &t2, std::mt19937 &randomNumberGenerator,
+        const unsigned int nPermutations, const float pValueThreshold, bool &isStoppedEarly);
+
     /**
      *  @brief  Calculate P value for measured correlation coefficient between two datasets via a integrating the student T dist.
      *
@@ -72,28 +92,6 @@ public:
     static float CalculateMean(const T &t);
 
 private:
-    /**
-     *  @brief  Make a randomised copy of a dataset
-     *
-     *  @param  t the dataset to be shuffled
-     *  @param  randomNumberGenerator the random number generator
-     *
-     *  @return the reshuffled dataset
-     */
-    template <typename T>
-    static T MakeRandomisedSample(const T &t, std::mt19937 &randomNumberGenerator);
-
-    /**
-     *  @brief  Make a randomised copy of dataset (dataset is an std::vector)
-     *
-     *  @param  t the std::vector-based dataset to be shuffled
-     *  @param  randomNumberGenerator the random number generator
-     *
-     *  @return the reshuffled std::vector
-     */
-    template <typename T>
-    static std::vector<T> MakeRandomisedSample(const std::vector<T> &t, std::mt19937 &randomNumberGenerator);
-
     /**
      *  @brief  Get the size the size of a dataset
      *
@@ -139,23 +137,6 @@ private:
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-template <typename T>
-inline std::vector<T> LArDiscreteProbabilityHelper::MakeRandomisedSample(const std::vector<T> &t, std::mt19937 &randomNumberGenerator)
-{
-    std::vector<T> randomisedVector(t);
-    std::shuffle(randomisedVector.begin(), randomisedVector.end(), randomNumberGenerator);
-
-    return randomisedVector;
-}
-
-template <>
-inline DiscreteProbabilityVector LArDiscreteProbabilityHelper::MakeRandomisedSample(const DiscreteProbabilityVector &t, std::mt19937 &randomNumberGenerator)
-{
-    return DiscreteProbabilityVector(t, randomNumberGenerator);
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 template <typename T>
 inline unsigned int LArDiscreteProbabilityHelper::GetSize(const std::vector<T> &t)
 {
@@ -12,6 +12,7 @@
 #include "larpandoracontent/LArHelpers/LArHierarchyHelper.h"
 
 #include <numeric>
+#include <unordered_map>
 
 namespace lar_content
 {
@@ -28,9 +29,8 @@ LArHierarchyHelper::MCHierarchy::MCHierarchy(const ReconstructabilityCriteria &r
 
 LArHierarchyHelper::MCHierarchy::~MCHierarchy()
 {
-    for (const Node *pNode : m_rootNodes)
-        delete pNode;
     m_rootNodes.clear();
+    m_nodeArena.Clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -52,6 +52,9 @@ void LArHierarchyHelper::MCHierarchy::FillHierarchy(
         }
     }
 
+    // ATTN Each node holds at least one distinct MC particle, so this is usually sufficient to store all nodes in a single allocation
+    m_nodeArena.Reserve(mcParticleList.size());
+
     MCParticleSet primarySet;
     m_pNeutrino = LArHierarchyHelper::GetMCPrimaries(mcParticleList, primarySet);
     MCParticleList primaries(primarySet.begin(), primarySet.end());
@@ -83,7 +86,7 @@ void LArHierarchyHelper::MCHierarchy::FillHierarchy(
                     allHits.insert(allHits.begin(), caloHits.begin(), caloHits.end());
                 }
             }
-            m_rootNodes.emplace_back(new Node(*this, allParticles, allHits));
+            m_rootNodes.emplace_back(m_nodeArena.Create(*this, allParticles, allHits));
         }
     }
     else if (foldToPrimaries && foldToLeadingShowers)
@@ -121,7 +124,7 @@ void LArHierarchyHelper::MCHierarchy::FillHierarchy(
                     allHits.insert(allHits.begin(), caloHits.begin(), caloHits.end());
                 }
             }
-            Node *pNode{new Node(*this, allParticles, allHits)};
+            Node *pNode{m_nodeArena.Create(*this, allParticles, allHits)};
             m_rootNodes.emplace_back(pNode);
             if (!showerParticles.empty())
             {
@@ -157,7 +160,7 @@ void LArHierarchyHelper::MCHierarchy::FillHierarchy(
                     allHits.insert(allHits.begin(), caloHits.begin(), caloHits.end());
                 }
             }
-            Node *pNode{new Node(*this, allParticles, allHits)};
+            Node *pNode{m_nodeArena.Create(*this, allParticles, allHits)};
             m_rootNodes.emplace_back(pNode);
             if (!(isShower || isNeutron))
             {
@@ -183,7 +186,7 @@ void LArHierarchyHelper::MCHierarchy::FillHierarchy(
                     allHits.insert(allHits.begin(), caloHits.begin(), caloHits.end());
                 }
             }
-            Node *pNode{new Node(*this, allParticles, allHits)};
+            Node *pNode{m_nodeArena.Create(*this, allParticles, allHits)};
             m_rootNodes.emplace_back(pNode);
             // Find the children of this particle and recursively add them to the hierarchy
             const MCParticleList &children{pPrimary->GetDaughterList()};
@@ -229,7 +232,7 @@ const std::string LArHierarchyHelper::MCHierarchy::ToString() const
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-LArHierarchyHelper::MCHierarchy::Node::Node(const MCHierarchy &hierarchy, const MCParticle *pMCParticle) :
+LArHierarchyHelper::MCHierarchy::Node::Node(MCHierarchy &hierarchy, const MCParticle *pMCParticle) :
     m_hierarchy(hierarchy),
     m_mainParticle(pMCParticle),
     m_pdg{0}
@@ -243,7 +246,7 @@ LArHierarchyHelper::MCHierarchy::Node::Node(const MCHierarchy &hierarchy, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-LArHierarchyHelper::MCHierarchy::Node::Node(const MCHierarchy &hierarchy, const MCParticleList &mcParticleList, const CaloHitList &caloHitList) :
+LArHierarchyHelper::MCHierarchy::Node::Node(MCHierarchy &hierarchy, const MCParticleList &mcParticleList, const CaloHitList &caloHitList) :
     m_hierarchy(hierarchy),
     m_mcParticles(mcParticleList),
     m_caloHits(caloHitList),
@@ -263,10 +266,9 @@ LArHierarchyHelper::MCHierarchy::Node::Node(const MCHierarchy &hierarchy, const
 
 LArHierarchyHelper::MCHierarchy::Node::~Node()
 {
+    // ATTN Child nodes are owned, and released, by the node arena of the parent hierarchy
     m_mcParticles.clear();
     m_caloHits.clear();
-    for (const Node *node : m_children)
-        delete node;
     m_children.clear();
 }
 
@@ -296,7 +298,7 @@ void LArHierarchyHelper::MCHierarchy::Node::FillHierarchy(const MCParticle *pRoo
 
     if (!allParticles.empty())
     {
-        Node *pNode{new Node(m_hierarchy, allParticles, allHits)};
+        Node *pNode{m_hierarchy.m_nodeArena.Create(m_hierarchy, allParticles, allHits)};
         m_children.emplace_back(pNode);
         if (!foldToLeadingShowers || (foldToLeadingShowers && !(isShower || isNeutron)))
         {
@@ -334,7 +336,7 @@ void LArHierarchyHelper::MCHierarchy::Node::FillFlat(const MCParticle *pRoot)
     }
     if (!allParticles.empty())
     {
-        Node *pNode{new Node(m_hierarchy, allParticles, allHits)};
+        Node *pNode{m_hierarchy.m_nodeArena.Create(m_hierarchy, allParticles, allHits)};
         m_children.emplace_back(pNode);
     }
 }
@@ -456,15 +458,17 @@ LArHierarchyHelper::RecoHierarchy::RecoHierarchy() : m_pNeutrino{nullptr}
 
 LArHierarchyHelper::RecoHierarchy::~RecoHierarchy()
 {
-    for (const Node *pNode : m_rootNodes)
-        delete pNode;
     m_rootNodes.clear();
+    m_nodeArena.Clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void LArHierarchyHelper::RecoHierarchy::FillHierarchy(const PfoList &pfoList, const bool foldToPrimaries, const bool foldToLeadingShowers)
 {
+    // ATTN Each node holds at least one distinct PFO, so this is usually sufficient to store all nodes in a single allocation
+    m_nodeArena.Reserve(pfoList.size());
+
     PfoSet primarySet;
     m_pNeutrino = LArHierarchyHelper::GetRecoPrimaries(pfoList, primarySet);
     PfoList primaries(primarySet.begin(), primarySet.end());
@@ -479,7 +483,7 @@ void LArHierarchyHelper::RecoHierarchy::FillHierarchy(const PfoList &pfoList, co
             CaloHitList allHits;
             for (const ParticleFlowObject *pPfo : allParticles)
                 LArPfoHelper::GetAllCaloHits(pPfo, allHits);
-            m_rootNodes.emplace_back(new Node(*this, allParticles, allHits));
+            m_rootNodes.emplace_back(m_nodeArena.Create(*this, allParticles, allHits));
         }
     }
     else if (foldToPrimaries && foldToLeadingShowers)
@@ -497,7 +501,7 @@ void LArHierarchyHelper::RecoHierarchy::FillHierarchy(const PfoList &pfoList, co
             CaloHitList allHits;
             for (const ParticleFlowObject *pPfo : allParticles)
                 LArPfoHelper::GetAllCaloHits(pPfo, allHits);
-            Node *pNode{new Node(*this, allParticles, allHits)};
+            Node *pNode{m_nodeArena.Create(*this, allParticles, allHits)};
             m_rootNodes.emplace_back(pNode);
             if (!showerParticles.empty())
             {
@@ -523,7 +527,7 @@ void LArHierarchyHelper::RecoHierarchy::FillHierarchy(const PfoList &pfoList, co
             CaloHitList allHits;
             for (const ParticleFlowObject *pPfo : allParticles)
                 LArPfoHelper::GetAllCaloHits(pPfo, allHits);
-            Node *pNode{new Node(*this, allParticles, allHits)};
+            Node *pNode{m_nodeArena.Create(*this, allParticles, allHits)};
             m_rootNodes.emplace_back(pNode);
             if (!isShower)
             {
@@ -542,7 +546,7 @@ void LArHierarchyHelper::RecoHierarchy::FillHierarchy(const PfoList &pfoList, co
             CaloHitList allHits;
             for (const ParticleFlowObject *pPfo : allParticles)
                 LArPfoHelper::GetAllCaloHits(pPfo, allHits);
-            Node *pNode{new Node(*this, allParticles, allHits)};
+            Node *pNode{m_nodeArena.Create(*this, allParticles, allHits)};
             m_rootNodes.emplace_back(pNode);
             // Find the children of this particle and recursively add them to the hierarchy
             const PfoList &children{pPrimary->GetDaughterPfoList()};
@@ -588,7 +592,7 @@ const std::string LArHierarchyHelper::RecoHierarchy::ToString() const
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-LArHierarchyHelper::RecoHierarchy::Node::Node(const RecoHierarchy &hierarchy, const ParticleFlowObject *pPfo) :
+LArHierarchyHelper::RecoHierarchy::Node::Node(RecoHierarchy &hierarchy, const ParticleFlowObject *pPfo) :
     m_hierarchy(hierarchy),
     m_pdg{0}
 {
@@ -601,7 +605,7 @@ LArHierarchyHelper::RecoHierarchy::Node::Node(const RecoHierarchy &hierarchy, co
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-LArHierarchyHelper::RecoHierarchy::Node::Node(const RecoHierarchy &hierarchy, const PfoList &pfoList, const CaloHitList &caloHitList) :
+LArHierarchyHelper::RecoHierarchy::Node::Node(RecoHierarchy &hierarchy, const PfoList &pfoList, const CaloHitList &caloHitList) :
     m_hierarchy(hierarchy),
     m_pdg{0}
 {
@@ -617,10 +621,9 @@ LArHierarchyHelper::RecoHierarchy::Node::Node(const RecoHierarchy &hierarchy, co
 
 LArHierarchyHelper::RecoHierarchy::Node::~Node()
 {
+    // ATTN Child nodes are owned, and released, by the node arena of the parent hierarchy
     m_pfos.clear();
     m_caloHits.clear();
-    for (const Node *node : m_children)
-        delete node;
     m_children.clear();
 }
 
@@ -639,7 +642,7 @@ void LArHierarchyHelper::RecoHierarchy::Node::FillHierarchy(const ParticleFlowOb
     CaloHitList allHits;
     for (const ParticleFlowObject *pPfo : allParticles)
         LArPfoHelper::GetAllCaloHits(pPfo, allHits);
-    Node *pNode{new Node(m_hierarchy, allParticles, allHits)};
+    Node *pNode{m_hierarchy.m_nodeArena.Create(m_hierarchy, allParticles, allHits)};
     m_children.emplace_back(pNode);
     if (!foldToLeadingShowers || (foldToLeadingShowers && !isShower))
     {
@@ -659,7 +662,7 @@ void LArHierarchyHelper::RecoHierarchy::Node::FillFlat(const ParticleFlowObject
     CaloHitList allHits;
     for (const ParticleFlowObject *pPfo : allParticles)
         LArPfoHelper::GetAllCaloHits(pPfo, allHits);
-    Node *pNode{new Node(m_hierarchy, allParticles, allHits)};
+    Node *pNode{m_hierarchy.m_nodeArena.Create(m_hierarchy, allParticles, allHits)};
     m_children.emplace_back(pNode);
 }
 
@@ -706,6 +709,8 @@ LArHierarchyHelper::MCMatches::MCMatches(const MCHierarchy::Node *pMCParticle) :
 
 void LArHierarchyHelper::MCMatches::AddRecoMatch(const RecoHierarchy::Node *pReco, const int nSharedHits)
 {
+    // ATTN Lookups resolve to the first match added for a given reco node
+    (void)m_recoNodeIndexMap.insert(RecoNodeIndexMap::value_type(pReco, m_recoNodes.size()));
     m_recoNodes.emplace_back(pReco);
     m_sharedHits.emplace_back(nSharedHits);
 }
@@ -714,39 +719,37 @@ void LArHierarchyHelper::MCMatches::AddRecoMatch(const RecoHierarchy::Node *pRec
 
 unsigned int LArHierarchyHelper::MCMatches::GetSharedHits(const RecoHierarchy::Node *pReco) const
 {
-    auto iter{std::find(m_recoNodes.begin(), m_recoNodes.end(), pReco)};
-    if (iter == m_recoNodes.end())
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
-    int index = iter - m_recoNodes.begin();
-
-    return static_cast<int>(m_sharedHits[index]);
+    return static_cast<int>(m_sharedHits[this->GetRecoIndex(pReco)]);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float LArHierarchyHelper::MCMatches::GetPurity(const RecoHierarchy::Node *pReco) const
 {
-    auto iter{std::find(m_recoNodes.begin(), m_recoNodes.end(), pReco)};
-    if (iter == m_recoNodes.end())
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
-    int index = iter - m_recoNodes.begin();
-
-    return m_sharedHits[index] / static_cast<float>(pReco->GetCaloHits().size());
+    return m_sharedHits[this->GetRecoIndex(pReco)] / static_cast<float>(pReco->GetCaloHits().size());
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float LArHierarchyHelper::MCMatches::GetCompleteness(const RecoHierarchy::Node *pReco) const
 {
-    auto iter{std::find(m_recoNodes.begin(), m_recoNodes.end(), pReco)};
-    if (iter == m_recoNodes.end())
-        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
-    const int index{static_cast<int>(std::distance(m_recoNodes.begin(), iter))};
+    const std::size_t index{this->GetRecoIndex(pReco)};
 
     const unsigned int nHits{static_cast<unsigned int>(m_pMCParticle->GetCaloHits().size())};
     return nHits ? m_sharedHits[index] / static_cast<float>(nHits) : 0.f;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::size_t LArHierarchyHelper::MCMatches::GetRecoIndex(const RecoHierarchy::Node *pReco) const
+{
+    const auto iter{m_recoNodeIndexMap.find(pReco)};
+    if (iter == m_recoNodeIndexMap.end())
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return iter->second;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -787,30 +790,52 @@ void LArHierarchyHelper::MatchInfo::Match(const MCHierarchy &mcHierarchy, const
     std::sort(recoNodes.begin(), recoNodes.end(),
         [](const RecoHierarchy::Node *lhs, const RecoHierarchy::Node *rhs) { return lhs->GetCaloHits().size() > rhs->GetCaloHits().size(); });
 
+    // Index the hits of the reconstructable MC nodes, so that the shared hit counts for all MC-reco node pairs (a sparse contingency
+    // table) can be accumulated in a single pass over the reco hits
+    std::vector<bool> isReconstructableVector;
+    std::unordered_multimap<const CaloHit *, size_t> hitToMCNodeIndexMap;
+    for (size_t mcIndex = 0; mcIndex < mcNodes.size(); ++mcIndex)
+    {
+        const MCHierarchy::Node *pMCNode{mcNodes.at(mcIndex)};
+        isReconstructableVector.emplace_back(pMCNode->IsReconstructable());
+        if (!isReconstructableVector.back())
+            continue;
+        for (const CaloHit *pCaloHit : pMCNode->GetCaloHits())
+            hitToMCNodeIndexMap.emplace(pCaloHit, mcIndex);
+    }
+
+    std::vector<size_t> sharedHitsVector(mcNodes.size(), 0);
+    std::vector<size_t> touchedMCIndices;
+
     std::map<const MCHierarchy::Node *, MCMatches> mcToMatchMap;
     for (const RecoHierarchy::Node *pRecoNode : recoNodes)
     {
-        const CaloHitList &recoHits{pRecoNode->GetCaloHits()};
-        const MCHierarchy::Node *pBestNode{nullptr};
-        size_t bestSharedHits{0};
-        for (const MCHierarchy::Node *pMCNode : mcNodes)
+        for (const CaloHit *pCaloHit : pRecoNode->GetCaloHits())
         {
-            if (!pMCNode->IsReconstructable())
-                continue;
-            const CaloHitList &mcHits{pMCNode->GetCaloHits()};
-            CaloHitVector intersection;
-            std::set_intersection(mcHits.begin(), mcHits.end(), recoHits.begin(), recoHits.end(), std::back_inserter(intersection));
+            const auto range{hitToMCNodeIndexMap.equal_range(pCaloHit)};
+            for (auto iter = range.first; iter != range.second; ++iter)
+            {
+                if (0 == sharedHitsVector[iter->second]++)
+                    touchedMCIndices.emplace_back(iter->second);
+            }
+        }
 
-            if (!intersection.empty())
+        // ATTN Ties are resolved in favour of the MC node appearing first in the sorted node vector
+        const MCHierarchy::Node *pBestNode{nullptr};
+        size_t bestSharedHits{0}, bestMCIndex{mcNodes.size()};
+        for (const size_t mcIndex : touchedMCIndices)
+        {
+            const size_t sharedHits{sharedHitsVector[mcIndex]};
+            if ((sharedHits > bestSharedHits) || ((sharedHits == bestSharedHits) && (mcIndex < bestMCIndex)))
             {
-                const size_t sharedHits{intersection.size()};
-                if (sharedHits > bestSharedHits)
-                {
-                    bestSharedHits = sharedHits;
-                    pBestNode = pMCNode;
-                }
+                bestSharedHits = sharedHits;
+                bestMCIndex = mcIndex;
+                pBestNode = mcNodes.at(mcIndex);
             }
+            sharedHitsVector[mcIndex] = 0;
         }
+        touchedMCIndices.clear();
+
         if (pBestNode)
         {
             auto iter{mcToMatchMap.find(pBestNode)};
@@ -858,9 +883,10 @@ void LArHierarchyHelper::MatchInfo::Match(const MCHierarchy &mcHierarchy, const
     std::sort(m_goodMatches.begin(), m_goodMatches.end(), predicate);
     std::sort(m_subThresholdMatches.begin(), m_subThresholdMatches.end(), predicate);
 
-    for (const MCHierarchy::Node *pMCNode : mcNodes)
+    for (size_t mcIndex = 0; mcIndex < mcNodes.size(); ++mcIndex)
     {
-        if (pMCNode->IsReconstructable() && mcToMatchMap.find(pMCNode) == mcToMatchMap.end())
+        const MCHierarchy::Node *pMCNode{mcNodes.at(mcIndex)};
+        if (isReconstructableVector.at(mcIndex) && mcToMatchMap.find(pMCNode) == mcToMatchMap.end())
             m_unmatchedMC.emplace_back(pMCNode);
     }
 }
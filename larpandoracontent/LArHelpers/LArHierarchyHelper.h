@@ -15,6 +15,12 @@
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -23,6 +29,49 @@ namespace lar_content
  */
 class LArHierarchyHelper
 {
+private:
+    /**
+     *  @brief  NodeArena class, providing chunked, contiguous storage for the nodes of a hierarchy, which are released together
+     */
+    template <typename T>
+    class NodeArena
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        NodeArena();
+
+        /**
+         *  @brief  Set the capacity of the next storage chunk, ideally to the total number of nodes expected
+         *
+         *  @param  nNodes the number of nodes expected
+         */
+        void Reserve(const size_t nNodes);
+
+        /**
+         *  @brief  Create a new node in the arena
+         *
+         *  @param  args the node constructor arguments
+         *
+         *  @return address of the new node, which remains valid until the arena is cleared
+         */
+        template <typename... Args>
+        T *Create(Args &&...args);
+
+        /**
+         *  @brief  Release all nodes in the arena
+         */
+        void Clear();
+
+    private:
+        typedef std::vector<T> Chunk;
+        typedef std::list<Chunk> ChunkList;
+
+        ChunkList m_chunks; ///< The storage chunks, each of which is never reallocated once created
+        size_t m_chunkSize; ///< The capacity of the next storage chunk
+    };
+
 public:
     /**
      *  @brief   MCHierarchy class
@@ -79,7 +128,7 @@ public:
              *  @param  hierarchy The parent hierarchy of this node
              *  @param  pMCParticle The primary MC particle with which this node should be created
              */
-            Node(const MCHierarchy &hierarchy, const pandora::MCParticle *pMCParticle);
+            Node(MCHierarchy &hierarchy, const pandora::MCParticle *pMCParticle);
 
             /**
              *  @brief  Create a node from a list of MC particles
@@ -88,7 +137,7 @@ public:
              *  @param  mcParticleList The MC particle list with which this node should be created
              *  @parasm caloHitList The CaloHit list with which this node should be created
              */
-            Node(const MCHierarchy &hierarchy, const pandora::MCParticleList &mcParticleList, const pandora::CaloHitList &caloHitList);
+            Node(MCHierarchy &hierarchy, const pandora::MCParticleList &mcParticleList, const pandora::CaloHitList &caloHitList);
 
             /**
              *  @brief Destructor
@@ -174,7 +223,7 @@ public:
             const std::string ToString(const std::string &prefix) const;
 
         private:
-            const MCHierarchy &m_hierarchy;            ///< The parent MC hierarchy
+            MCHierarchy &m_hierarchy;                  ///< The parent MC hierarchy
             pandora::MCParticleList m_mcParticles;     ///< The list of MC particles of which this node is composed
             pandora::CaloHitList m_caloHits;           ///< The list of calo hits of which this node is composed
             NodeVector m_children;                     ///< The child nodes of this node
@@ -262,6 +311,7 @@ public:
         bool IsTestBeamHierarchy() const;
 
     private:
+        NodeArena<Node> m_nodeArena;               ///< The storage for all nodes in the hierarchy
         NodeVector m_rootNodes;                    ///< The leading nodes (e.g. primary particles, cosmic rays, ...)
         ReconstructabilityCriteria m_recoCriteria; ///< The criteria used to determine if the node is reconstructable
         const pandora::MCParticle *m_pNeutrino;    ///< The incident neutrino, if it exists
@@ -290,7 +340,7 @@ public:
              *  @param  hierarchy The parent hierarchy of this node
              *  @param  pPfo The primary PFO with which this node should be created
              */
-            Node(const RecoHierarchy &hierarchy, const pandora::ParticleFlowObject *pPfo);
+            Node(RecoHierarchy &hierarchy, const pandora::ParticleFlowObject *pPfo);
 
             /**
              *  @brief  Create a node from a list of PFOs
@@ -299,7 +349,7 @@ public:
              *  @param  pfoList The PFO list with which this node should be created
              *  @parasm caloHitList The CaloHit list with which this node should be created
              */
-            Node(const RecoHierarchy &hierarchy, const pandora::PfoList &pfoList, const pandora::CaloHitList &caloHitList);
+            Node(RecoHierarchy &hierarchy, const pandora::PfoList &pfoList, const pandora::CaloHitList &caloHitList);
 
             /**
              *  @brief Destructor
@@ -358,7 +408,7 @@ public:
             const std::string ToString(const std::string &prefix) const;
 
         private:
-            const RecoHierarchy &m_hierarchy; ///< The parent reco hierarchy
+            RecoHierarchy &m_hierarchy;       ///< The parent reco hierarchy
             pandora::PfoList m_pfos;          ///< The list of PFOs of which this node is composed
             pandora::CaloHitList m_caloHits;  ///< The list of calo hits of which this node is composed
             NodeVector m_children;            ///< The child nodes of this node
@@ -422,6 +472,7 @@ public:
         const std::string ToString() const;
 
     private:
+        NodeArena<Node> m_nodeArena;                    ///< The storage for all nodes in the hierarchy
         NodeVector m_rootNodes;                         ///< The leading nodes (e.g. primary particles, cosmic rays, ...)
         const pandora::ParticleFlowObject *m_pNeutrino; ///< The incident neutrino, if it exists
     };
@@ -489,9 +540,21 @@ public:
         float GetCompleteness(const RecoHierarchy::Node *pReco) const;
 
     private:
+        typedef std::unordered_map<const RecoHierarchy::Node *, std::size_t> RecoNodeIndexMap;
+
+        /**
+         *  @brief  Retrieve the index of a matched reco node
+         *
+         *  @param  pReco The reco node to consider
+         *
+         *  @return The index of the reco node in the vector of matched reco nodes
+         */
+        std::size_t GetRecoIndex(const RecoHierarchy::Node *pReco) const;
+
         const MCHierarchy::Node *m_pMCParticle; ///< MC node associated with any matches
         RecoHierarchy::NodeVector m_recoNodes;  ///< Matched reco nodes
         pandora::IntVector m_sharedHits;        ///< Number of shared hits for each match
+        RecoNodeIndexMap m_recoNodeIndexMap;    ///< The index of each matched reco node, for constant time lookup
     };
 
     typedef std::vector<MCMatches> MCMatchesVector;
@@ -638,6 +701,47 @@ private:
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+inline LArHierarchyHelper::NodeArena<T>::NodeArena() : m_chunkSize{256}
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void LArHierarchyHelper::NodeArena<T>::Reserve(const size_t nNodes)
+{
+    m_chunkSize = std::max(nNodes, static_cast<size_t>(1));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+template <typename... Args>
+inline T *LArHierarchyHelper::NodeArena<T>::Create(Args &&...args)
+{
+    // ATTN Chunks are never grown beyond their reserved capacity, so node addresses remain stable
+    if (m_chunks.empty() || (m_chunks.back().size() == m_chunks.back().capacity()))
+    {
+        m_chunks.emplace_back();
+        m_chunks.back().reserve(m_chunkSize);
+    }
+
+    m_chunks.back().emplace_back(std::forward<Args>(args)...);
+    return &m_chunks.back().back();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void LArHierarchyHelper::NodeArena<T>::Clear()
+{
+    m_chunks.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline const LArHierarchyHelper::MCHierarchy::NodeVector &LArHierarchyHelper::MCHierarchy::Node::GetChildren() const
 {
     return m_children;
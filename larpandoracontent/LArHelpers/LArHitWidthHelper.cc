@@ -5,8 +5,11 @@
  *
  *  $Log: $
  */
-#include "larpandoracontent/LArHelpers/LArHitWidthHelper.h"
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArHitWidthHelper.h"
+
+#include <algorithm>
+#include <limits>
 
 using namespace pandora;
 
@@ -33,15 +36,36 @@ bool LArHitWidthHelper::ConstituentHit::SortByDistanceToPoint::operator()(const
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+LArHitWidthHelper::ConstituentHitArrays::ConstituentHitArrays(const ConstituentHitVector &constituentHitVector)
+{
+    m_xPositions.reserve(constituentHitVector.size());
+    m_yPositions.reserve(constituentHitVector.size());
+    m_zPositions.reserve(constituentHitVector.size());
+
+    for (const ConstituentHit &constituentHit : constituentHitVector)
+    {
+        const CartesianVector &positionVector(constituentHit.GetPositionVector());
+        m_xPositions.push_back(positionVector.GetX());
+        m_yPositions.push_back(positionVector.GetY());
+        m_zPositions.push_back(positionVector.GetZ());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 LArHitWidthHelper::ClusterParameters::ClusterParameters(
     const Cluster *const pCluster, const float maxConstituentHitWidth, const bool isUniformHits, const float hitWidthScalingFactor) :
     m_pCluster(pCluster),
     m_numCaloHits(pCluster->GetNCaloHits()),
     m_constituentHitVector(LArHitWidthHelper::GetConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, isUniformHits)),
+    m_constituentHitArrays(m_constituentHitVector),
     m_totalWeight(LArHitWidthHelper::GetTotalClusterWeight(m_constituentHitVector)),
-    m_lowerXExtrema(LArHitWidthHelper::GetExtremalCoordinatesLowerX(m_constituentHitVector)),
-    m_higherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(m_constituentHitVector))
+    m_lowerXExtrema(0.f, 0.f, 0.f),
+    m_higherXExtrema(0.f, 0.f, 0.f)
 {
+    // ATTN calculate both extremal points in a single pass over the constituent hits
+    LArHitWidthHelper::GetExtremalCoordinatesX(m_constituentHitArrays, m_lowerXExtrema, m_higherXExtrema);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -51,6 +75,7 @@ LArHitWidthHelper::ClusterParameters::ClusterParameters(const Cluster *const pCl
     m_pCluster(pCluster),
     m_numCaloHits(numCaloHits),
     m_constituentHitVector(constituentHitVector),
+    m_constituentHitArrays(m_constituentHitVector),
     m_totalWeight(totalWeight),
     m_lowerXExtrema(lowerXExtrema),
     m_higherXExtrema(higherXExtrema)
@@ -87,6 +112,26 @@ const LArHitWidthHelper::ClusterParameters &LArHitWidthHelper::GetClusterParamet
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const LArHitWidthHelper::ClusterParameters &LArHitWidthHelper::GetCachedClusterParameters(const Cluster *const pCluster,
+    const float maxConstituentHitWidth, const bool isUniformHits, const float hitWidthScalingFactor, ClusterToParametersMap &clusterToParametersCacheMap)
+{
+    const auto clusterParametersIter(clusterToParametersCacheMap.find(pCluster));
+
+    if (clusterParametersIter != clusterToParametersCacheMap.end())
+    {
+        if (clusterParametersIter->second.GetNumCaloHits() == pCluster->GetNCaloHits())
+            return clusterParametersIter->second;
+
+        clusterToParametersCacheMap.erase(clusterParametersIter);
+    }
+
+    return clusterToParametersCacheMap
+        .emplace(pCluster, ClusterParameters(pCluster, maxConstituentHitWidth, isUniformHits, hitWidthScalingFactor))
+        .first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 unsigned int LArHitWidthHelper::GetNProposedConstituentHits(const Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor)
 {
     if (maxConstituentHitWidth < std::numeric_limits<float>::epsilon())
@@ -223,11 +268,20 @@ float LArHitWidthHelper::GetOriginalTotalClusterWeight(const Cluster *const pClu
 CartesianPointVector LArHitWidthHelper::GetConstituentHitPositionVector(const ConstituentHitVector &constituentHitVector)
 {
     CartesianPointVector constituentHitPositionVector;
+    LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitVector, constituentHitPositionVector);
+
+    return constituentHitPositionVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArHitWidthHelper::GetConstituentHitPositionVector(
+    const ConstituentHitVector &constituentHitVector, CartesianPointVector &constituentHitPositionVector)
+{
+    constituentHitPositionVector.reserve(constituentHitPositionVector.size() + constituentHitVector.size());
 
     for (const ConstituentHit &constituentHit : constituentHitVector)
         constituentHitPositionVector.push_back(constituentHit.GetPositionVector());
-
-    return constituentHitPositionVector;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -255,10 +309,17 @@ CartesianVector LArHitWidthHelper::GetExtremalCoordinatesHigherX(const Constitue
 void LArHitWidthHelper::GetExtremalCoordinatesX(
     const ConstituentHitVector &constituentHitVector, CartesianVector &lowerXCoordinate, CartesianVector &higherXCoordinate)
 {
-    const CartesianPointVector &constituentHitPositionVector(GetConstituentHitPositionVector(constituentHitVector));
+    LArHitWidthHelper::GetExtremalCoordinatesX(ConstituentHitArrays(constituentHitVector), lowerXCoordinate, higherXCoordinate);
+}
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArHitWidthHelper::GetExtremalCoordinatesX(
+    const ConstituentHitArrays &constituentHitArrays, CartesianVector &lowerXCoordinate, CartesianVector &higherXCoordinate)
+{
     CartesianVector innerCoordinate(0.f, 0.f, 0.f), outerCoordinate(0.f, 0.f, 0.f);
-    LArClusterHelper::GetExtremalCoordinates(constituentHitPositionVector, innerCoordinate, outerCoordinate);
+    LArClusterHelper::GetExtremalCoordinates(
+        constituentHitArrays.GetNConstituentHits(), constituentHitArrays, innerCoordinate, outerCoordinate);
 
     // set the lower/higher XCoordinate (in the event of a tie, use z)
     const float deltaX(outerCoordinate.GetX() - innerCoordinate.GetX());
@@ -319,4 +380,32 @@ float LArHitWidthHelper::GetClosestDistanceToPoint2D(const CaloHit *const pCaloH
     return std::sqrt((deltaX * deltaX) + (modDeltaZ * modDeltaZ));
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector LArHitWidthHelper::GetClosestConstituentHitPosition(const CartesianVector &position, const ConstituentHitArrays &constituentHitArrays)
+{
+    const unsigned int nConstituentHits(constituentHitArrays.GetNConstituentHits());
+
+    if (0 == nConstituentHits)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    const float *const pX(constituentHitArrays.GetXPositions().data());
+    const float *const pY(constituentHitArrays.GetYPositions().data());
+    const float *const pZ(constituentHitArrays.GetZPositions().data());
+    const float positionX(position.GetX()), positionY(position.GetY()), positionZ(position.GetZ());
+
+    // ATTN separate the (vectorisable) distance calculation from the search for the first minimum
+    FloatVector distanceSquaredVector(nConstituentHits);
+
+    for (unsigned int i = 0; i < nConstituentHits; ++i)
+    {
+        const float deltaX(pX[i] - positionX), deltaY(pY[i] - positionY), deltaZ(pZ[i] - positionZ);
+        distanceSquaredVector[i] = deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ;
+    }
+
+    const FloatVector::const_iterator minIter(std::min_element(distanceSquaredVector.begin(), distanceSquaredVector.end()));
+
+    return constituentHitArrays.GetPositionVector(std::distance(distanceSquaredVector.cbegin(), minIter));
+}
+
 } // namespace lar_content
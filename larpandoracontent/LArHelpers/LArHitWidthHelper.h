@@ -86,6 +86,73 @@ public:
 
     typedef std::vector<ConstituentHit> ConstituentHitVector;
 
+    /**
+     *  @brief  ConstituentHitArrays class, holding the constituent hit positions as contiguous (structure of arrays) vectors
+     */
+    class ConstituentHitArrays
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  constituentHitVector the input vector of constituent hits
+         */
+        ConstituentHitArrays(const ConstituentHitVector &constituentHitVector);
+
+        /**
+         *  @brief  Returns the number of constituent hits
+         */
+        unsigned int GetNConstituentHits() const;
+
+        /**
+         *  @brief  Returns the constituent hit central x positions
+         */
+        const pandora::FloatVector &GetXPositions() const;
+
+        /**
+         *  @brief  Returns the constituent hit central y positions
+         */
+        const pandora::FloatVector &GetYPositions() const;
+
+        /**
+         *  @brief  Returns the constituent hit central z positions
+         */
+        const pandora::FloatVector &GetZPositions() const;
+
+        /**
+         *  @brief  Returns the central x position of a specified constituent hit
+         *
+         *  @param  index the index of the constituent hit
+         */
+        float GetX(const unsigned int index) const;
+
+        /**
+         *  @brief  Returns the central y position of a specified constituent hit
+         *
+         *  @param  index the index of the constituent hit
+         */
+        float GetY(const unsigned int index) const;
+
+        /**
+         *  @brief  Returns the central z position of a specified constituent hit
+         *
+         *  @param  index the index of the constituent hit
+         */
+        float GetZ(const unsigned int index) const;
+
+        /**
+         *  @brief  Returns the central position of a specified constituent hit
+         *
+         *  @param  index the index of the constituent hit
+         */
+        pandora::CartesianVector GetPositionVector(const unsigned int index) const;
+
+    private:
+        pandora::FloatVector m_xPositions; ///< The constituent hit central x positions
+        pandora::FloatVector m_yPositions; ///< The constituent hit central y positions
+        pandora::FloatVector m_zPositions; ///< The constituent hit central z positions
+    };
+
     /**
      *  @brief  ClusterParameters class
      */
@@ -138,6 +205,11 @@ public:
          */
         const ConstituentHitVector &GetConstituentHitVector() const;
 
+        /**
+         *  @brief  Returns the constituent hit positions and widths, as contiguous arrays
+         */
+        const ConstituentHitArrays &GetConstituentHitArrays() const;
+
         /**
          *  @brief  Returns the lower x extremal point of the constituent hits
          */
@@ -152,9 +224,10 @@ public:
         const pandora::Cluster *m_pCluster;                ///< The address of the cluster
         const unsigned int m_numCaloHits;                  ///< The number of calo hits within the cluster
         const ConstituentHitVector m_constituentHitVector; ///< The vector of constituent hits
+        const ConstituentHitArrays m_constituentHitArrays; ///< The constituent hit positions and widths, as contiguous arrays
         const float m_totalWeight;                         ///< The total hit weight of the contituent hits
-        const pandora::CartesianVector m_lowerXExtrema;    ///< The lower x extremal point of the constituent hits
-        const pandora::CartesianVector m_higherXExtrema;   ///< The higher x extremal point of the constituent hits
+        pandora::CartesianVector m_lowerXExtrema;          ///< The lower x extremal point of the constituent hits
+        pandora::CartesianVector m_higherXExtrema;         ///< The higher x extremal point of the constituent hits
     };
 
     typedef std::unordered_map<const pandora::Cluster *, const ClusterParameters> ClusterToParametersMap;
@@ -196,6 +269,21 @@ public:
      */
     static const ClusterParameters &GetClusterParameters(const pandora::Cluster *const pCluster, const ClusterToParametersMap &clusterToParametersMap);
 
+    /**
+     *  @brief  Return the cluster parameters of a given cluster from a cache map, (re)calculating them if the cluster is absent from the
+     *          map or if its number of calo hits has changed since they were cached e.g. because it has been enlarged by a merge
+     *
+     *  @param  pCluster the input cluster
+     *  @param  maxConstituentHitWidth the maximum width of a constituent hit
+     *  @param  isUniformHits whether to break up the hit into uniform constituent hits (and pad the hit) or not
+     *  @param  hitWidthScalingFactor the constituent hit width scaling factor
+     *  @param  clusterToParametersCacheMap the cache map [cluster -> cluster parameter], all entries must use the same settings
+     *
+     *  @return  the up-to-date cluster parameters of the input cluster
+     */
+    static const ClusterParameters &GetCachedClusterParameters(const pandora::Cluster *const pCluster, const float maxConstituentHitWidth,
+        const bool isUniformHits, const float hitWidthScalingFactor, ClusterToParametersMap &clusterToParametersCacheMap);
+
     /**
      *  @brief  Return the number of constituent hits that a given cluster would be broken into
      *
@@ -244,6 +332,15 @@ public:
      */
     static pandora::CartesianPointVector GetConstituentHitPositionVector(const ConstituentHitVector &constituentHitVector);
 
+    /**
+     *  @brief  Obtain a vector of the contituent hit central positions
+     *
+     *  @param  constituentHitVector the input vector of contituent hits
+     *  @param  constituentHitPositionVector to receive the constituent hit central positions
+     */
+    static void GetConstituentHitPositionVector(
+        const ConstituentHitVector &constituentHitVector, pandora::CartesianPointVector &constituentHitPositionVector);
+
     /**
      *  @brief  Sum the widths of constituent hits
      *
@@ -290,6 +387,16 @@ public:
     static void GetExtremalCoordinatesX(const ConstituentHitVector &constituentHitVector, pandora::CartesianVector &lowerXCoordinate,
         pandora::CartesianVector &higherXCoordinate);
 
+    /**
+     *  @brief  Calculate the higher and lower x extremal points of the constituent hits, using the contiguous constituent hit arrays
+     *
+     *  @param  constituentHitArrays the input constituent hit arrays
+     *  @param  lowerXCoordinate the lower x extremal point
+     *  @param  higherXCoordinate the higher x extremal point
+     */
+    static void GetExtremalCoordinatesX(const ConstituentHitArrays &constituentHitArrays, pandora::CartesianVector &lowerXCoordinate,
+        pandora::CartesianVector &higherXCoordinate);
+
     /**
      *  @brief  Consider the hit width to find the closest position of a calo hit to a specified line
      *
@@ -311,6 +418,17 @@ public:
      *  @return  the smallest distance
      */
     static float GetClosestDistanceToPoint2D(const pandora::CaloHit *const pCaloHit, const pandora::CartesianVector &point2D);
+
+    /**
+     *  @brief  Find the central position of the constituent hit closest to a given point (the first, in the event of a tie)
+     *
+     *  @param  position the position
+     *  @param  constituentHitArrays the input constituent hit arrays
+     *
+     *  @return  the closest constituent hit central position
+     */
+    static pandora::CartesianVector GetClosestConstituentHitPosition(
+        const pandora::CartesianVector &position, const ConstituentHitArrays &constituentHitArrays);
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -337,6 +455,63 @@ inline const pandora::Cluster *LArHitWidthHelper::ConstituentHit::GetParentClust
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline unsigned int LArHitWidthHelper::ConstituentHitArrays::GetNConstituentHits() const
+{
+    return m_xPositions.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::FloatVector &LArHitWidthHelper::ConstituentHitArrays::GetXPositions() const
+{
+    return m_xPositions;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::FloatVector &LArHitWidthHelper::ConstituentHitArrays::GetYPositions() const
+{
+    return m_yPositions;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::FloatVector &LArHitWidthHelper::ConstituentHitArrays::GetZPositions() const
+{
+    return m_zPositions;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float LArHitWidthHelper::ConstituentHitArrays::GetX(const unsigned int index) const
+{
+    return m_xPositions[index];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float LArHitWidthHelper::ConstituentHitArrays::GetY(const unsigned int index) const
+{
+    return m_yPositions[index];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float LArHitWidthHelper::ConstituentHitArrays::GetZ(const unsigned int index) const
+{
+    return m_zPositions[index];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::CartesianVector LArHitWidthHelper::ConstituentHitArrays::GetPositionVector(const unsigned int index) const
+{
+    return pandora::CartesianVector(m_xPositions.at(index), m_yPositions.at(index), m_zPositions.at(index));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline const pandora::Cluster *LArHitWidthHelper::ClusterParameters::GetClusterAddress() const
 {
     return m_pCluster;
@@ -365,6 +540,13 @@ inline const LArHitWidthHelper::ConstituentHitVector &LArHitWidthHelper::Cluster
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline const LArHitWidthHelper::ConstituentHitArrays &LArHitWidthHelper::ClusterParameters::GetConstituentHitArrays() const
+{
+    return m_constituentHitArrays;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline const pandora::CartesianVector &LArHitWidthHelper::ClusterParameters::GetLowerXExtrema() const
 {
     return m_lowerXExtrema;
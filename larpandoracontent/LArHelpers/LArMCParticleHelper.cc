@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <limits>
 
 namespace lar_content
 {
@@ -42,6 +43,183 @@ LArMCParticleHelper::PrimaryParameters::PrimaryParameters() :
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+const unsigned int LArMCParticleHelper::MCHierarchyIndex::NO_INDEX(std::numeric_limits<unsigned int>::max());
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArMCParticleHelper::MCHierarchyIndex::MCHierarchyIndex(const MCParticleList *const pMCParticleList, const int hierarchyTierLimit)
+{
+    // Identify the root of every hierarchy touched by the input list, stopping each upward walk at an already visited particle
+    MCParticleVector rootMCParticles;
+    MCParticleSet visitedMCParticles;
+
+    for (const MCParticle *const pMCParticle : *pMCParticleList)
+    {
+        const MCParticle *pCurrentMCParticle(pMCParticle);
+
+        while (visitedMCParticles.insert(pCurrentMCParticle).second)
+        {
+            if (pCurrentMCParticle->GetParentList().empty())
+            {
+                rootMCParticles.push_back(pCurrentMCParticle);
+                break;
+            }
+
+            pCurrentMCParticle = *(pCurrentMCParticle->GetParentList().begin());
+        }
+    }
+
+    // Flatten each hierarchy depth first, propagating primary and leading particles from parent to daughter
+    IndexVector nVisibleVector;
+    std::vector<bool> isAmbiguousVector;
+
+    typedef std::pair<unsigned int, MCParticleList::const_iterator> DaughterIterator;
+    std::vector<DaughterIterator> daughterIteratorStack;
+
+    for (const MCParticle *const pRootMCParticle : rootMCParticles)
+    {
+        const bool isBeamHierarchy(LArMCParticleHelper::IsBeamParticle(pRootMCParticle));
+
+        auto addMCParticle = [&](const MCParticle *const pMCParticle, const unsigned int parentIndex) -> unsigned int {
+            const unsigned int index(m_mcParticleVector.size());
+            const bool hasParent(NO_INDEX != parentIndex);
+            const bool isVisible(LArMCParticleHelper::IsVisible(pMCParticle));
+
+            // ATTN Particles with multiple parents cannot be folded to a primary or leading particle, as per the per-particle parent walks
+            const bool isAmbiguous((hasParent && isAmbiguousVector.at(parentIndex)) || (pMCParticle->GetParentList().size() > 1));
+            const unsigned int nVisible((hasParent ? nVisibleVector.at(parentIndex) : 0) + (isVisible ? 1 : 0));
+
+            unsigned int primaryIndex(NO_INDEX);
+            if (!isAmbiguous)
+                primaryIndex = (hasParent && (NO_INDEX != m_primaryIndices.at(parentIndex))) ? m_primaryIndices.at(parentIndex) : (isVisible ? index : NO_INDEX);
+
+            unsigned int leadingIndex(primaryIndex);
+            if (!isAmbiguous && isBeamHierarchy)
+                leadingIndex = (isVisible && (static_cast<int>(nVisible) - 1 <= hierarchyTierLimit)) ? index
+                                                                                                        : (hasParent ? m_leadingIndices.at(parentIndex) : NO_INDEX);
+
+            m_mcParticleVector.push_back(pMCParticle);
+            m_mcParticleIndexMap[pMCParticle] = index;
+            m_parentIndices.push_back(parentIndex);
+            m_subtreeEndIndices.push_back(NO_INDEX);
+            m_primaryIndices.push_back(primaryIndex);
+            m_leadingIndices.push_back(leadingIndex);
+            nVisibleVector.push_back(nVisible);
+            isAmbiguousVector.push_back(isAmbiguous);
+
+            return index;
+        };
+
+        daughterIteratorStack.emplace_back(addMCParticle(pRootMCParticle, NO_INDEX), pRootMCParticle->GetDaughterList().begin());
+
+        while (!daughterIteratorStack.empty())
+        {
+            const unsigned int index(daughterIteratorStack.back().first);
+            MCParticleList::const_iterator &daughterIter(daughterIteratorStack.back().second);
+
+            if (m_mcParticleVector.at(index)->GetDaughterList().end() == daughterIter)
+            {
+                m_subtreeEndIndices.at(index) = m_mcParticleVector.size();
+                daughterIteratorStack.pop_back();
+                continue;
+            }
+
+            const MCParticle *const pDaughterMCParticle(*daughterIter);
+            ++daughterIter;
+
+            // ATTN Particles with multiple parents are placed beneath the first parent from which they are reached
+            if (m_mcParticleIndexMap.count(pDaughterMCParticle))
+                continue;
+
+            daughterIteratorStack.emplace_back(addMCParticle(pDaughterMCParticle, index), pDaughterMCParticle->GetDaughterList().begin());
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArMCParticleHelper::MCHierarchyIndex::Contains(const MCParticle *const pMCParticle) const
+{
+    return (m_mcParticleIndexMap.find(pMCParticle) != m_mcParticleIndexMap.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MCParticleVector &LArMCParticleHelper::MCHierarchyIndex::GetTopologicalOrder() const
+{
+    return m_mcParticleVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MCParticle *LArMCParticleHelper::MCHierarchyIndex::GetPrimaryMCParticle(const MCParticle *const pMCParticle) const
+{
+    const unsigned int primaryIndex(m_primaryIndices.at(this->GetIndex(pMCParticle)));
+
+    if (NO_INDEX == primaryIndex)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return m_mcParticleVector.at(primaryIndex);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const MCParticle *LArMCParticleHelper::MCHierarchyIndex::GetLeadingMCParticle(const MCParticle *const pMCParticle) const
+{
+    const unsigned int leadingIndex(m_leadingIndices.at(this->GetIndex(pMCParticle)));
+
+    if (NO_INDEX == leadingIndex)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return m_mcParticleVector.at(leadingIndex);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMCParticleHelper::MCHierarchyIndex::GetAllDescendentMCParticles(const MCParticle *const pMCParticle, MCParticleList &descendentMCParticleList) const
+{
+    const unsigned int index(this->GetIndex(pMCParticle));
+    descendentMCParticleList.insert(
+        descendentMCParticleList.end(), m_mcParticleVector.begin() + index + 1, m_mcParticleVector.begin() + m_subtreeEndIndices.at(index));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMCParticleHelper::MCHierarchyIndex::GetAllAncestorMCParticles(const MCParticle *const pMCParticle, MCParticleList &ancestorMCParticleList) const
+{
+    unsigned int index(m_parentIndices.at(this->GetIndex(pMCParticle)));
+
+    while (NO_INDEX != index)
+    {
+        ancestorMCParticleList.push_back(m_mcParticleVector.at(index));
+        index = m_parentIndices.at(index);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArMCParticleHelper::MCHierarchyIndex::IsDescendentOf(const MCParticle *const pMCParticle, const MCParticle *const pAncestorMCParticle) const
+{
+    const unsigned int index(this->GetIndex(pMCParticle)), ancestorIndex(this->GetIndex(pAncestorMCParticle));
+
+    return ((index > ancestorIndex) && (index < m_subtreeEndIndices.at(ancestorIndex)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int LArMCParticleHelper::MCHierarchyIndex::GetIndex(const MCParticle *const pMCParticle) const
+{
+    MCParticleIndexMap::const_iterator iter(m_mcParticleIndexMap.find(pMCParticle));
+
+    if (m_mcParticleIndexMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool LArMCParticleHelper::DoesPrimaryMeetCriteria(const MCParticle *const pMCParticle, std::function<bool(const MCParticle *const)> fCriteria)
 {
     try
@@ -248,14 +426,8 @@ const MCParticle *LArMCParticleHelper::GetParentMCParticle(const MCParticle *con
 
 void LArMCParticleHelper::GetAllDescendentMCParticles(const pandora::MCParticle *const pMCParticle, pandora::MCParticleList &descendentMCParticleList)
 {
-    for (const MCParticle *pDaughterMCParticle : pMCParticle->GetDaughterList())
-    {
-        if (std::find(descendentMCParticleList.begin(), descendentMCParticleList.end(), pDaughterMCParticle) == descendentMCParticleList.end())
-        {
-            descendentMCParticleList.emplace_back(pDaughterMCParticle);
-            LArMCParticleHelper::GetAllDescendentMCParticles(pDaughterMCParticle, descendentMCParticleList);
-        }
-    }
+    MCParticleSet descendentMCParticleSet(descendentMCParticleList.begin(), descendentMCParticleList.end());
+    LArMCParticleHelper::GetAllDescendentMCParticles(pMCParticle, descendentMCParticleList, descendentMCParticleSet);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -263,43 +435,30 @@ void LArMCParticleHelper::GetAllDescendentMCParticles(const pandora::MCParticle
 void LArMCParticleHelper::GetAllDescendentMCParticles(const MCParticle *const pMCParticle, MCParticleList &descendentTrackParticles,
     MCParticleList &leadingShowerParticles, MCParticleList &leadingNeutrons)
 {
-    for (const MCParticle *pDaughterMCParticle : pMCParticle->GetDaughterList())
-    {
-        if (std::find(descendentTrackParticles.begin(), descendentTrackParticles.end(), pDaughterMCParticle) == descendentTrackParticles.end())
-        {
-            const int pdg{std::abs(pDaughterMCParticle->GetParticleId())};
-            if (pdg == E_MINUS || pdg == PHOTON)
-            {
-                leadingShowerParticles.emplace_back(pDaughterMCParticle);
-            }
-            else if (pdg == NEUTRON)
-            {
-                leadingNeutrons.emplace_back(pDaughterMCParticle);
-            }
-            else
-            {
-                descendentTrackParticles.emplace_back(pDaughterMCParticle);
-                LArMCParticleHelper::GetAllDescendentMCParticles(pDaughterMCParticle, descendentTrackParticles, leadingShowerParticles, leadingNeutrons);
-            }
-        }
-    }
+    MCParticleSet descendentTrackParticleSet(descendentTrackParticles.begin(), descendentTrackParticles.end());
+    LArMCParticleHelper::GetAllDescendentMCParticles(
+        pMCParticle, descendentTrackParticles, leadingShowerParticles, leadingNeutrons, descendentTrackParticleSet);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void LArMCParticleHelper::GetAllAncestorMCParticles(const pandora::MCParticle *const pMCParticle, pandora::MCParticleList &ancestorMCParticleList)
 {
-    const MCParticleList &parentMCParticleList = pMCParticle->GetParentList();
-    if (parentMCParticleList.empty())
-        return;
-    if (parentMCParticleList.size() != 1)
-        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    MCParticleSet ancestorMCParticleSet(ancestorMCParticleList.begin(), ancestorMCParticleList.end());
+    const MCParticle *pCurrentMCParticle(pMCParticle);
 
-    const MCParticle *pParentMCParticle = *parentMCParticleList.begin();
-    if (std::find(ancestorMCParticleList.begin(), ancestorMCParticleList.end(), pParentMCParticle) == ancestorMCParticleList.end())
+    while (!pCurrentMCParticle->GetParentList().empty())
     {
+        const MCParticleList &parentMCParticleList = pCurrentMCParticle->GetParentList();
+        if (parentMCParticleList.size() != 1)
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+        const MCParticle *const pParentMCParticle = *parentMCParticleList.begin();
+        if (!ancestorMCParticleSet.insert(pParentMCParticle).second)
+            return;
+
         ancestorMCParticleList.push_back(pParentMCParticle);
-        LArMCParticleHelper::GetAllAncestorMCParticles(pParentMCParticle, ancestorMCParticleList);
+        pCurrentMCParticle = pParentMCParticle;
     }
 }
 
@@ -417,11 +576,13 @@ const MCParticle *LArMCParticleHelper::GetLeadingMCParticle(const MCParticle *co
 
 void LArMCParticleHelper::GetMCPrimaryMap(const MCParticleList *const pMCParticleList, MCRelationMap &mcPrimaryMap)
 {
+    const MCHierarchyIndex mcHierarchyIndex(pMCParticleList);
+
     for (const MCParticle *const pMCParticle : *pMCParticleList)
     {
         try
         {
-            const MCParticle *const pPrimaryMCParticle = LArMCParticleHelper::GetPrimaryMCParticle(pMCParticle);
+            const MCParticle *const pPrimaryMCParticle = mcHierarchyIndex.GetPrimaryMCParticle(pMCParticle);
             mcPrimaryMap[pMCParticle] = pPrimaryMCParticle;
         }
         catch (const StatusCodeException &)
@@ -434,11 +595,13 @@ void LArMCParticleHelper::GetMCPrimaryMap(const MCParticleList *const pMCParticl
 
 void LArMCParticleHelper::GetMCLeadingMap(const MCParticleList *const pMCParticleList, MCRelationMap &mcLeadingMap)
 {
+    const MCHierarchyIndex mcHierarchyIndex(pMCParticleList);
+
     for (const MCParticle *const pMCParticle : *pMCParticleList)
     {
         try
         {
-            const MCParticle *const pLeadingMCParticle = LArMCParticleHelper::GetLeadingMCParticle(pMCParticle);
+            const MCParticle *const pLeadingMCParticle = mcHierarchyIndex.GetLeadingMCParticle(pMCParticle);
             mcLeadingMap[pMCParticle] = pLeadingMCParticle;
         }
         catch (const StatusCodeException &)
@@ -641,10 +804,13 @@ void LArMCParticleHelper::GetTestBeamHierarchyPfoToReconstructable2DHitsMap(cons
 void LArMCParticleHelper::GetPfoToReconstructable2DHitsMap(const PfoList &pfoList, const MCContributionMapVector &selectedMCParticleToHitsMaps,
     PfoContributionMap &pfoToReconstructable2DHitsMap, const bool foldBackHierarchy)
 {
+    CaloHitSet targetCaloHitSet;
+    LArMCParticleHelper::GetTargetCaloHitSet(selectedMCParticleToHitsMaps, targetCaloHitSet);
+
     for (const ParticleFlowObject *const pPfo : pfoList)
     {
         CaloHitList pfoHitList;
-        LArMCParticleHelper::CollectReconstructable2DHits(pPfo, selectedMCParticleToHitsMaps, pfoHitList, foldBackHierarchy);
+        LArMCParticleHelper::CollectReconstructable2DHits(pPfo, targetCaloHitSet, pfoHitList, foldBackHierarchy);
 
         if (!pfoToReconstructable2DHitsMap.insert(PfoContributionMap::value_type(pPfo, pfoHitList)).second)
             throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
@@ -656,10 +822,13 @@ void LArMCParticleHelper::GetPfoToReconstructable2DHitsMap(const PfoList &pfoLis
 void LArMCParticleHelper::GetTestBeamHierarchyPfoToReconstructable2DHitsMap(const PfoList &pfoList,
     const MCContributionMapVector &selectedMCParticleToHitsMaps, PfoContributionMap &pfoToReconstructable2DHitsMap, const bool foldBackHierarchy)
 {
+    CaloHitSet targetCaloHitSet;
+    LArMCParticleHelper::GetTargetCaloHitSet(selectedMCParticleToHitsMaps, targetCaloHitSet);
+
     for (const ParticleFlowObject *const pPfo : pfoList)
     {
         CaloHitList pfoHitList;
-        LArMCParticleHelper::CollectReconstructableTestBeamHierarchy2DHits(pPfo, selectedMCParticleToHitsMaps, pfoHitList, foldBackHierarchy);
+        LArMCParticleHelper::CollectReconstructableTestBeamHierarchy2DHits(pPfo, targetCaloHitSet, pfoHitList, foldBackHierarchy);
 
         if (!pfoToReconstructable2DHitsMap.insert(PfoContributionMap::value_type(pPfo, pfoHitList)).second)
             throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
@@ -677,28 +846,60 @@ void LArMCParticleHelper::GetPfoMCParticleHitSharingMaps(const PfoContributionMa
         sortedPfos.push_back(mapEntry.first);
     std::sort(sortedPfos.begin(), sortedPfos.end(), LArPfoHelper::SortByNHits);
 
-    for (const ParticleFlowObject *const pPfo : sortedPfos)
+    // ATTN Hit to mc particle indices are built once, so shared hits for every pfo-mc pairing are accumulated in a single pass over pfo hits
+    CaloHitToMCParticlesMapVector hitToMCParticlesMaps;
+    LArMCParticleHelper::GetCaloHitToMCParticlesMaps(selectedMCParticleToHitsMaps, hitToMCParticlesMaps);
+
+    bool hasMCParticles(false);
+
+    if (!sortedPfos.empty())
     {
         for (const MCContributionMap &mcParticleToHitsMap : selectedMCParticleToHitsMaps)
         {
-            MCParticleVector sortedMCParticles;
             for (const auto &mapEntry : mcParticleToHitsMap)
-                sortedMCParticles.push_back(mapEntry.first);
-            std::sort(sortedMCParticles.begin(), sortedMCParticles.end(), PointerLessThan<MCParticle>());
+            {
+                hasMCParticles = true;
+                (void)mcParticleToPfoHitSharingMap.insert(MCParticleToPfoHitSharingMap::value_type(mapEntry.first, PfoToSharedHitsVector()));
+            }
+        }
+    }
+
+    for (const ParticleFlowObject *const pPfo : sortedPfos)
+    {
+        if (!hasMCParticles)
+            break;
 
-            for (const MCParticle *const pMCParticle : sortedMCParticles)
+        // Add map entry for this Pfo if required
+        if (pfoToMCParticleHitSharingMap.find(pPfo) == pfoToMCParticleHitSharingMap.end())
+            if (!pfoToMCParticleHitSharingMap.insert(PfoToMCParticleHitSharingMap::value_type(pPfo, MCParticleToSharedHitsVector())).second)
+                throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT); // ATTN maybe overkill
+
+        MCParticleToSharedHitsVector &mcHitPairs(pfoToMCParticleHitSharingMap.at(pPfo));
+        const CaloHitList &pfoHitList(pfoToReconstructable2DHitsMap.at(pPfo));
+
+        for (const CaloHitToMCParticlesMap &hitToMCParticlesMap : hitToMCParticlesMaps)
+        {
+            MCContributionMap mcToSharedHitsMap;
+
+            for (const CaloHit *const pCaloHit : pfoHitList)
             {
-                // Add map entries for this Pfo & MCParticle if required
-                if (pfoToMCParticleHitSharingMap.find(pPfo) == pfoToMCParticleHitSharingMap.end())
-                    if (!pfoToMCParticleHitSharingMap.insert(PfoToMCParticleHitSharingMap::value_type(pPfo, MCParticleToSharedHitsVector())).second)
-                        throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT); // ATTN maybe overkill
+                CaloHitToMCParticlesMap::const_iterator iter(hitToMCParticlesMap.find(pCaloHit));
 
-                if (mcParticleToPfoHitSharingMap.find(pMCParticle) == mcParticleToPfoHitSharingMap.end())
-                    if (!mcParticleToPfoHitSharingMap.insert(MCParticleToPfoHitSharingMap::value_type(pMCParticle, PfoToSharedHitsVector())).second)
-                        throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+                if (hitToMCParticlesMap.end() == iter)
+                    continue;
 
-                // Check this Pfo & MCParticle pairing hasn't already been checked
-                MCParticleToSharedHitsVector &mcHitPairs(pfoToMCParticleHitSharingMap.at(pPfo));
+                for (const MCParticle *const pMCParticle : iter->second)
+                    mcToSharedHitsMap[pMCParticle].push_back(pCaloHit);
+            }
+
+            MCParticleVector sharingMCParticles;
+            for (const auto &mapEntry : mcToSharedHitsMap)
+                sharingMCParticles.push_back(mapEntry.first);
+            std::sort(sharingMCParticles.begin(), sharingMCParticles.end(), PointerLessThan<MCParticle>());
+
+            for (const MCParticle *const pMCParticle : sharingMCParticles)
+            {
+                // Check this Pfo & MCParticle pairing hasn't already been recorded
                 PfoToSharedHitsVector &pfoHitPairs(mcParticleToPfoHitSharingMap.at(pMCParticle));
 
                 if (std::any_of(mcHitPairs.begin(), mcHitPairs.end(),
@@ -708,34 +909,54 @@ void LArMCParticleHelper::GetPfoMCParticleHitSharingMaps(const PfoContributionMa
                 if (std::any_of(pfoHitPairs.begin(), pfoHitPairs.end(), [&](const PfoCaloHitListPair &pair) { return (pair.first == pPfo); }))
                     throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
 
-                // Add records to maps if there are any shared hits
-                const CaloHitList sharedHits(
-                    LArMCParticleHelper::GetSharedHits(pfoToReconstructable2DHitsMap.at(pPfo), mcParticleToHitsMap.at(pMCParticle)));
+                const CaloHitList &sharedHits(mcToSharedHitsMap.at(pMCParticle));
+                mcHitPairs.push_back(MCParticleCaloHitListPair(pMCParticle, sharedHits));
+                pfoHitPairs.push_back(PfoCaloHitListPair(pPfo, sharedHits));
+            }
+        }
+    }
 
-                if (!sharedHits.empty())
-                {
-                    mcHitPairs.push_back(MCParticleCaloHitListPair(pMCParticle, sharedHits));
-                    pfoHitPairs.push_back(PfoCaloHitListPair(pPfo, sharedHits));
+    for (auto &mapEntry : pfoToMCParticleHitSharingMap)
+    {
+        MCParticleToSharedHitsVector &mcHitPairs(mapEntry.second);
+        std::sort(mcHitPairs.begin(), mcHitPairs.end(), [](const MCParticleCaloHitListPair &a, const MCParticleCaloHitListPair &b) -> bool {
+            return ((a.second.size() != b.second.size()) ? a.second.size() > b.second.size() : LArMCParticleHelper::SortByMomentum(a.first, b.first));
+        });
+    }
 
-                    std::sort(mcHitPairs.begin(), mcHitPairs.end(), [](const MCParticleCaloHitListPair &a, const MCParticleCaloHitListPair &b) -> bool {
-                        return ((a.second.size() != b.second.size()) ? a.second.size() > b.second.size()
-                                                                     : LArMCParticleHelper::SortByMomentum(a.first, b.first));
-                    });
+    for (auto &mapEntry : mcParticleToPfoHitSharingMap)
+    {
+        PfoToSharedHitsVector &pfoHitPairs(mapEntry.second);
+        std::sort(pfoHitPairs.begin(), pfoHitPairs.end(), [](const PfoCaloHitListPair &a, const PfoCaloHitListPair &b) -> bool {
+            return ((a.second.size() != b.second.size()) ? a.second.size() > b.second.size() : LArPfoHelper::SortByNHits(a.first, b.first));
+        });
+    }
+}
 
-                    std::sort(pfoHitPairs.begin(), pfoHitPairs.end(), [](const PfoCaloHitListPair &a, const PfoCaloHitListPair &b) -> bool {
-                        return ((a.second.size() != b.second.size()) ? a.second.size() > b.second.size() : LArPfoHelper::SortByNHits(a.first, b.first));
-                    });
-                }
-            }
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMCParticleHelper::GetCaloHitToMCParticlesMaps(
+    const MCContributionMapVector &selectedMCParticleToHitsMaps, CaloHitToMCParticlesMapVector &hitToMCParticlesMaps)
+{
+    for (const MCContributionMap &mcParticleToHitsMap : selectedMCParticleToHitsMaps)
+    {
+        CaloHitToMCParticlesMap hitToMCParticlesMap;
+
+        for (const MCContributionMap::value_type &mapEntry : mcParticleToHitsMap)
+        {
+            for (const CaloHit *const pCaloHit : mapEntry.second)
+                hitToMCParticlesMap[pCaloHit].push_back(mapEntry.first);
         }
+
+        hitToMCParticlesMaps.push_back(std::move(hitToMCParticlesMap));
     }
 }
 
 // private
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void LArMCParticleHelper::CollectReconstructable2DHits(const ParticleFlowObject *const pPfo,
-    const MCContributionMapVector &selectedMCParticleToHitsMaps, pandora::CaloHitList &reconstructableCaloHitList2D, const bool foldBackHierarchy)
+void LArMCParticleHelper::CollectReconstructable2DHits(const ParticleFlowObject *const pPfo, const CaloHitSet &targetCaloHitSet,
+    pandora::CaloHitList &reconstructableCaloHitList2D, const bool foldBackHierarchy)
 {
 
     PfoList pfoList;
@@ -751,13 +972,13 @@ void LArMCParticleHelper::CollectReconstructable2DHits(const ParticleFlowObject
         pfoList.push_back(pPfo);
     }
 
-    LArMCParticleHelper::CollectReconstructable2DHits(pfoList, selectedMCParticleToHitsMaps, reconstructableCaloHitList2D);
+    LArMCParticleHelper::CollectReconstructable2DHits(pfoList, targetCaloHitSet, reconstructableCaloHitList2D);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void LArMCParticleHelper::CollectReconstructableTestBeamHierarchy2DHits(const ParticleFlowObject *const pPfo,
-    const MCContributionMapVector &selectedMCParticleToHitsMaps, pandora::CaloHitList &reconstructableCaloHitList2D, const bool foldBackHierarchy)
+void LArMCParticleHelper::CollectReconstructableTestBeamHierarchy2DHits(const ParticleFlowObject *const pPfo, const CaloHitSet &targetCaloHitSet,
+    pandora::CaloHitList &reconstructableCaloHitList2D, const bool foldBackHierarchy)
 {
 
     PfoList pfoList;
@@ -780,13 +1001,13 @@ void LArMCParticleHelper::CollectReconstructableTestBeamHierarchy2DHits(const Pa
         pfoList.push_back(pPfo);
     }
 
-    LArMCParticleHelper::CollectReconstructable2DHits(pfoList, selectedMCParticleToHitsMaps, reconstructableCaloHitList2D);
+    LArMCParticleHelper::CollectReconstructable2DHits(pfoList, targetCaloHitSet, reconstructableCaloHitList2D);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void LArMCParticleHelper::CollectReconstructable2DHits(
-    const PfoList &pfoList, const MCContributionMapVector &selectedMCParticleToHitsMaps, pandora::CaloHitList &reconstructableCaloHitList2D)
+    const PfoList &pfoList, const CaloHitSet &targetCaloHitSet, pandora::CaloHitList &reconstructableCaloHitList2D)
 {
     CaloHitList caloHitList2D;
     LArPfoHelper::GetCaloHits(pfoList, TPC_VIEW_U, caloHitList2D);
@@ -799,29 +1020,24 @@ void LArMCParticleHelper::CollectReconstructable2DHits(
     // Filter for only reconstructable hits
     for (const CaloHit *const pCaloHit : caloHitList2D)
     {
-        bool isTargetHit(false);
-        for (const MCContributionMap &mcParticleToHitsMap : selectedMCParticleToHitsMaps)
-        {
-            // ATTN This map is unordered, but this does not impact search for specific target hit
-            for (const MCContributionMap::value_type &mapEntry : mcParticleToHitsMap)
-            {
-                if (std::find(mapEntry.second.begin(), mapEntry.second.end(), pCaloHit) != mapEntry.second.end())
-                {
-                    isTargetHit = true;
-                    break;
-                }
-            }
-            if (isTargetHit)
-                break;
-        }
-
-        if (isTargetHit)
+        if (targetCaloHitSet.count(pCaloHit))
             reconstructableCaloHitList2D.push_back(pCaloHit);
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArMCParticleHelper::GetTargetCaloHitSet(const MCContributionMapVector &selectedMCParticleToHitsMaps, CaloHitSet &targetCaloHitSet)
+{
+    for (const MCContributionMap &mcParticleToHitsMap : selectedMCParticleToHitsMaps)
+    {
+        for (const MCContributionMap::value_type &mapEntry : mcParticleToHitsMap)
+            targetCaloHitSet.insert(mapEntry.second.begin(), mapEntry.second.end());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LArMCParticleHelper::SelectCaloHits(const CaloHitList *const pCaloHitList, const LArMCParticleHelper::MCRelationMap &mcToTargetMCMap,
     CaloHitList &selectedCaloHitList, const bool selectInputHits, const float maxPhotonPropagation)
 {
@@ -1049,13 +1265,58 @@ bool LArMCParticleHelper::PassMCParticleChecks(const MCParticle *const pOriginal
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArMCParticleHelper::GetAllDescendentMCParticles(
+    const MCParticle *const pMCParticle, MCParticleList &descendentMCParticleList, MCParticleSet &descendentMCParticleSet)
+{
+    for (const MCParticle *pDaughterMCParticle : pMCParticle->GetDaughterList())
+    {
+        if (descendentMCParticleSet.insert(pDaughterMCParticle).second)
+        {
+            descendentMCParticleList.emplace_back(pDaughterMCParticle);
+            LArMCParticleHelper::GetAllDescendentMCParticles(pDaughterMCParticle, descendentMCParticleList, descendentMCParticleSet);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMCParticleHelper::GetAllDescendentMCParticles(const MCParticle *const pMCParticle, MCParticleList &descendentTrackParticles,
+    MCParticleList &leadingShowerParticles, MCParticleList &leadingNeutrons, MCParticleSet &descendentTrackParticleSet)
+{
+    for (const MCParticle *pDaughterMCParticle : pMCParticle->GetDaughterList())
+    {
+        if (descendentTrackParticleSet.count(pDaughterMCParticle))
+            continue;
+
+        const int pdg{std::abs(pDaughterMCParticle->GetParticleId())};
+        if (pdg == E_MINUS || pdg == PHOTON)
+        {
+            leadingShowerParticles.emplace_back(pDaughterMCParticle);
+        }
+        else if (pdg == NEUTRON)
+        {
+            leadingNeutrons.emplace_back(pDaughterMCParticle);
+        }
+        else
+        {
+            descendentTrackParticleSet.insert(pDaughterMCParticle);
+            descendentTrackParticles.emplace_back(pDaughterMCParticle);
+            LArMCParticleHelper::GetAllDescendentMCParticles(
+                pDaughterMCParticle, descendentTrackParticles, leadingShowerParticles, leadingNeutrons, descendentTrackParticleSet);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 CaloHitList LArMCParticleHelper::GetSharedHits(const CaloHitList &hitListA, const CaloHitList &hitListB)
 {
     CaloHitList sharedHits;
+    const CaloHitSet caloHitSetB(hitListB.begin(), hitListB.end());
 
     for (const CaloHit *const pCaloHit : hitListA)
     {
-        if (std::find(hitListB.begin(), hitListB.end(), pCaloHit) != hitListB.end())
+        if (caloHitSetB.count(pCaloHit))
             sharedHits.push_back(pCaloHit);
     }
 
@@ -31,6 +31,8 @@ public:
 
     typedef std::unordered_map<const pandora::CaloHit *, const pandora::MCParticle *> CaloHitToMCMap;
     typedef std::unordered_map<const pandora::CaloHit *, const pandora::ParticleFlowObject *> CaloHitToPfoMap;
+    typedef std::unordered_map<const pandora::CaloHit *, pandora::MCParticleVector> CaloHitToMCParticlesMap;
+    typedef std::vector<CaloHitToMCParticlesMap> CaloHitToMCParticlesMapVector;
 
     typedef std::unordered_map<const pandora::MCParticle *, pandora::CaloHitList> MCContributionMap;
     typedef std::vector<MCContributionMap> MCContributionMapVector;
@@ -67,6 +69,103 @@ public:
         bool m_foldBackHierarchy; ///< whether to fold the hierarchy back to the primary (neutrino) or leading particles (test beam)
     };
 
+    /**
+     *  @brief   MCHierarchyIndex class, a precomputed, flattened representation of the mc particle hierarchy for a single event
+     */
+    class MCHierarchyIndex
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pMCParticleList the input mc particle list, from which the full hierarchy (including any parents and daughters) is indexed
+         *  @param  hierarchyTierLimit the hierarchy tier limit used to identify leading mc particles
+         */
+        MCHierarchyIndex(const pandora::MCParticleList *const pMCParticleList, const int hierarchyTierLimit = 1);
+
+        /**
+         *  @brief  Whether the index contains a given mc particle
+         *
+         *  @param  pMCParticle the address of the mc particle
+         *
+         *  @return boolean
+         */
+        bool Contains(const pandora::MCParticle *const pMCParticle) const;
+
+        /**
+         *  @brief  Get the indexed mc particles in topological (depth first, parents before daughters) order
+         *
+         *  @return the mc particle vector
+         */
+        const pandora::MCParticleVector &GetTopologicalOrder() const;
+
+        /**
+         *  @brief  Get the primary parent mc particle, as per LArMCParticleHelper::GetPrimaryMCParticle
+         *
+         *  @param  pMCParticle the input mc particle
+         *
+         *  @return address of the primary parent mc particle
+         */
+        const pandora::MCParticle *GetPrimaryMCParticle(const pandora::MCParticle *const pMCParticle) const;
+
+        /**
+         *  @brief  Get the leading mc particle, as per LArMCParticleHelper::GetLeadingMCParticle with the configured tier limit
+         *
+         *  @param  pMCParticle the input mc particle
+         *
+         *  @return address of the leading mc particle
+         */
+        const pandora::MCParticle *GetLeadingMCParticle(const pandora::MCParticle *const pMCParticle) const;
+
+        /**
+         *  @brief  Get all descendent mc particles, in the order provided by LArMCParticleHelper::GetAllDescendentMCParticles
+         *
+         *  @param  pMCParticle the input mc particle
+         *  @param  descendentMCParticleList to receive the descendent mc particles
+         */
+        void GetAllDescendentMCParticles(const pandora::MCParticle *const pMCParticle, pandora::MCParticleList &descendentMCParticleList) const;
+
+        /**
+         *  @brief  Get all ancestor mc particles, ordered from the immediate parent upwards
+         *
+         *  @param  pMCParticle the input mc particle
+         *  @param  ancestorMCParticleList to receive the ancestor mc particles
+         */
+        void GetAllAncestorMCParticles(const pandora::MCParticle *const pMCParticle, pandora::MCParticleList &ancestorMCParticleList) const;
+
+        /**
+         *  @brief  Whether one mc particle is a descendent of another
+         *
+         *  @param  pMCParticle the candidate descendent mc particle
+         *  @param  pAncestorMCParticle the candidate ancestor mc particle
+         *
+         *  @return boolean
+         */
+        bool IsDescendentOf(const pandora::MCParticle *const pMCParticle, const pandora::MCParticle *const pAncestorMCParticle) const;
+
+    private:
+        typedef std::unordered_map<const pandora::MCParticle *, unsigned int> MCParticleIndexMap;
+        typedef std::vector<unsigned int> IndexVector;
+
+        /**
+         *  @brief  Get the position of a given mc particle in the flattened hierarchy
+         *
+         *  @param  pMCParticle the address of the mc particle
+         *
+         *  @return the position
+         */
+        unsigned int GetIndex(const pandora::MCParticle *const pMCParticle) const;
+
+        static const unsigned int NO_INDEX; ///< The sentinel value used to indicate a missing parent, primary or leading particle
+
+        pandora::MCParticleVector m_mcParticleVector; ///< The mc particles, in depth first order (a flattened euler tour)
+        MCParticleIndexMap m_mcParticleIndexMap;      ///< The mapping from mc particle to position in the flattened hierarchy
+        IndexVector m_parentIndices;                  ///< The position of the parent of each mc particle
+        IndexVector m_subtreeEndIndices;              ///< The (exclusive) end of the descendent range of each mc particle
+        IndexVector m_primaryIndices;                 ///< The position of the primary mc particle for each mc particle
+        IndexVector m_leadingIndices;                 ///< The position of the leading mc particle for each mc particle
+    };
+
     /**
      *  @brief  Returns true if passed particle whose primary meets the passed criteria
      *
@@ -383,6 +482,15 @@ public:
         const MCContributionMapVector &selectedMCParticleToHitsMaps, PfoToMCParticleHitSharingMap &pfoToMCParticleHitSharingMap,
         MCParticleToPfoHitSharingMap &mcParticleToPfoHitSharingMap);
 
+    /**
+     *  @brief  Index the hits in a set of mc contribution maps, so that the mc particles owning a given hit can be found in constant time
+     *
+     *  @param  selectedMCParticleToHitsMaps the input mappings from selected reconstructable MCParticles to hits
+     *  @param  hitToMCParticlesMaps the output hit to mc particles indices, one per input mapping
+     */
+    static void GetCaloHitToMCParticlesMaps(
+        const MCContributionMapVector &selectedMCParticleToHitsMaps, CaloHitToMCParticlesMapVector &hitToMCParticlesMaps);
+
     /**
      *  @brief  Select a subset of calo hits representing those that represent "reconstructable" regions of the event
      *
@@ -433,11 +541,11 @@ private:
      *  @brief  For a given Pfo, collect the hits which are reconstructable (=good hits belonging to a selected reconstructable MCParticle)
      *
      *  @param  pPfo the input pfo
-     *  @param  selectedMCParticleToHitsMaps the input mappings from selected reconstructable MCParticles to hits
+     *  @param  targetCaloHitSet the set of all hits belonging to selected reconstructable MCParticles
      *  @param  reconstructableCaloHitList2D the output list of reconstructable 2D calo hits in the input pfo
      *  @param  foldBackHierarchy whether to fold the particle hierarchy back to primaries
      */
-    static void CollectReconstructable2DHits(const pandora::ParticleFlowObject *const pPfo, const MCContributionMapVector &selectedMCParticleToHitsMaps,
+    static void CollectReconstructable2DHits(const pandora::ParticleFlowObject *const pPfo, const pandora::CaloHitSet &targetCaloHitSet,
         pandora::CaloHitList &reconstructableCaloHitList2D, const bool foldBackHierarchy);
 
     /**
@@ -445,22 +553,30 @@ private:
      *          and belong in the test beam particle interaction hierarchy
      *
      *  @param  pPfo the input pfo
-     *  @param  selectedMCParticleToHitsMaps the input mappings from selected reconstructable MCParticles to hits
+     *  @param  targetCaloHitSet the set of all hits belonging to selected reconstructable MCParticles
      *  @param  reconstructableCaloHitList2D the output list of reconstructable 2D calo hits in the input pfo
      *  @param  foldBackHierarchy whether to fold the particle hierarchy back to leading particles
      */
     static void CollectReconstructableTestBeamHierarchy2DHits(const pandora::ParticleFlowObject *const pPfo,
-        const MCContributionMapVector &selectedMCParticleToHitsMaps, pandora::CaloHitList &reconstructableCaloHitList2D, const bool foldBackHierarchy);
+        const pandora::CaloHitSet &targetCaloHitSet, pandora::CaloHitList &reconstructableCaloHitList2D, const bool foldBackHierarchy);
 
     /**
      *  @brief  For a given Pfo list, collect the hits which are reconstructable (=good hits belonging to a selected reconstructable MCParticle)
      *
      *  @param  pfoList the input pfo list
-     *  @param  selectedMCParticleToHitsMaps the input mappings from selected reconstructable MCParticles to hits
+     *  @param  targetCaloHitSet the set of all hits belonging to selected reconstructable MCParticles
      *  @param  reconstructableCaloHitList2D the output list of reconstructable 2D calo hits in the input pfo
      */
-    static void CollectReconstructable2DHits(const pandora::PfoList &pfoList, const MCContributionMapVector &selectedMCParticleToHitsMaps,
-        pandora::CaloHitList &reconstructableCaloHitList2D);
+    static void CollectReconstructable2DHits(
+        const pandora::PfoList &pfoList, const pandora::CaloHitSet &targetCaloHitSet, pandora::CaloHitList &reconstructableCaloHitList2D);
+
+    /**
+     *  @brief  Collect the set of all hits belonging to selected reconstructable MCParticles
+     *
+     *  @param  selectedMCParticleToHitsMaps the input mappings from selected reconstructable MCParticles to hits
+     *  @param  targetCaloHitSet the output set of target hits
+     */
+    static void GetTargetCaloHitSet(const MCContributionMapVector &selectedMCParticleToHitsMaps, pandora::CaloHitSet &targetCaloHitSet);
 
     /**
      *  @brief  Apply further selection criteria to end up with a collection of "good" calo hits that can be use to define whether
@@ -501,6 +617,29 @@ private:
     static bool PassMCParticleChecks(const pandora::MCParticle *const pOriginalPrimary, const pandora::MCParticle *const pThisMCParticle,
         const pandora::MCParticle *const pHitMCParticle, const float maxPhotonPropagation);
 
+    /**
+     *  @brief  Get all descendent mc particles, skipping any particles already present in the output
+     *
+     *  @param  pMCParticle the input mc particle
+     *  @param  descendentMCParticleList the output descendent mc particle list
+     *  @param  descendentMCParticleSet the set of particles already present in the output list
+     */
+    static void GetAllDescendentMCParticles(const pandora::MCParticle *const pMCParticle, pandora::MCParticleList &descendentMCParticleList,
+        pandora::MCParticleSet &descendentMCParticleSet);
+
+    /**
+     *  @brief  Get all descendent mc particles, separated into track-like, shower-like and neutron branches, skipping any track-like
+     *          particles already present in the output
+     *
+     *  @param  pMCParticle the input mc particle
+     *  @param  descendentTrackParticles the output list of descendent track-like particles
+     *  @param  leadingShowerParticles the output list of leading shower particles
+     *  @param  leadingNeutrons the output list of leading neutrons
+     *  @param  descendentTrackParticleSet the set of particles already present in the output track-like list
+     */
+    static void GetAllDescendentMCParticles(const pandora::MCParticle *const pMCParticle, pandora::MCParticleList &descendentTrackParticles,
+        pandora::MCParticleList &leadingShowerParticles, pandora::MCParticleList &leadingNeutrons, pandora::MCParticleSet &descendentTrackParticleSet);
+
     /**
      *  @brief  Get the hits in the intersection of two hit lists
      *
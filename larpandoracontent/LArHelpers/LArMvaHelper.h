@@ -8,6 +8,8 @@
 #ifndef LAR_MVA_HELPER_H
 #define LAR_MVA_HELPER_H 1
 
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
+
 #include "larpandoracontent/LArObjects/LArMvaInterface.h"
 
 #include "Pandora/AlgorithmTool.h"
@@ -56,6 +58,7 @@ class LArMvaHelper
 public:
     typedef MvaTypes::MvaFeature MvaFeature;
     typedef MvaTypes::MvaFeatureVector MvaFeatureVector;
+    typedef std::vector<MvaFeatureVector> MvaFeatureVectorList;
 
     /**
      *  @brief  Produce a training example with the given features and result
@@ -101,6 +104,30 @@ public:
     template <typename... TLISTS>
     static double CalculateProbability(const MvaInterface &classifier, TLISTS &&... featureLists);
 
+    /**
+     *  @brief  Use the trained classifer to calculate the classification scores of a batch of examples, sharing the examples between threads
+     *
+     *  @param  classifier the classifier
+     *  @param  featureVectorList the feature vectors, one per example
+     *  @param  nRequestedThreads the requested number of threads, zero to use the hardware concurrency
+     *
+     *  @return the classification scores, in the order of the input examples
+     */
+    static std::vector<double> CalculateClassificationScores(
+        const MvaInterface &classifier, const MvaFeatureVectorList &featureVectorList, const unsigned int nRequestedThreads);
+
+    /**
+     *  @brief  Use the trained mva to calculate the classification probabilities of a batch of examples, sharing the examples between threads
+     *
+     *  @param  classifier the classifier
+     *  @param  featureVectorList the feature vectors, one per example
+     *  @param  nRequestedThreads the requested number of threads, zero to use the hardware concurrency
+     *
+     *  @return the classification probabilities, in the order of the input examples
+     */
+    static std::vector<double> CalculateProbabilities(
+        const MvaInterface &classifier, const MvaFeatureVectorList &featureVectorList, const unsigned int nRequestedThreads);
+
     /**
      *  @brief  Calculate the features in a given feature tool vector
      *
@@ -240,6 +267,32 @@ double LArMvaHelper::CalculateProbability(const MvaInterface &classifier, TLISTS
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline std::vector<double> LArMvaHelper::CalculateClassificationScores(
+    const MvaInterface &classifier, const MvaFeatureVectorList &featureVectorList, const unsigned int nRequestedThreads)
+{
+    std::vector<double> scores(featureVectorList.size(), 0.);
+
+    LArParallelHelper::ForEachIndex(featureVectorList.size(), nRequestedThreads,
+        [&](const std::size_t index) { scores[index] = classifier.CalculateClassificationScore(featureVectorList[index]); });
+
+    return scores;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline std::vector<double> LArMvaHelper::CalculateProbabilities(
+    const MvaInterface &classifier, const MvaFeatureVectorList &featureVectorList, const unsigned int nRequestedThreads)
+{
+    std::vector<double> probabilities(featureVectorList.size(), 0.);
+
+    LArParallelHelper::ForEachIndex(featureVectorList.size(), nRequestedThreads,
+        [&](const std::size_t index) { probabilities[index] = classifier.CalculateProbability(featureVectorList[index]); });
+
+    return probabilities;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename... Ts, typename... TARGS>
 LArMvaHelper::MvaFeatureVector LArMvaHelper::CalculateFeatures(const MvaFeatureToolVector<Ts...> &featureToolVector, TARGS &&... args)
 {
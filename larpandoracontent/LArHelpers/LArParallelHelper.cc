@@ -0,0 +1,24 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArParallelHelper.cc
+ *
+ *  @brief  Implementation of the parallel helper class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
+
+namespace lar_content
+{
+
+unsigned int LArParallelHelper::GetNumberOfThreads(const unsigned int nRequestedThreads)
+{
+    if (nRequestedThreads > 0)
+        return nRequestedThreads;
+
+    // ATTN hardware_concurrency may return zero if the value is not computable
+    const unsigned int nHardwareThreads(std::thread::hardware_concurrency());
+    return ((nHardwareThreads > 0) ? nHardwareThreads : 1);
+}
+
+} // namespace lar_content
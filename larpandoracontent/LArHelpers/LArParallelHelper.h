@@ -0,0 +1,103 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArParallelHelper.h
+ *
+ *  @brief  Header file for the parallel helper class
+ *
+ *  $Log: $
+ */
+#ifndef LAR_PARALLEL_HELPER_H
+#define LAR_PARALLEL_HELPER_H 1
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArParallelHelper class
+ */
+class LArParallelHelper
+{
+public:
+    /**
+     *  @brief  Get the number of worker threads to use for a requested thread count
+     *
+     *  @param  nRequestedThreads the requested number of threads, zero to use the hardware concurrency
+     *
+     *  @return the number of worker threads, at least one
+     */
+    static unsigned int GetNumberOfThreads(const unsigned int nRequestedThreads);
+
+    /**
+     *  @brief  Call a function for each index in [0, nItems), sharing the indices dynamically between a number of worker threads.
+     *          The function must only read shared state and write to per-index output. Runs inline if only one thread is required.
+     *          The first exception raised by any call is rethrown once all workers have finished.
+     *
+     *  @param  nItems the number of indices
+     *  @param  nRequestedThreads the requested number of threads, zero to use the hardware concurrency
+     *  @param  function the function to call, taking a single std::size_t index
+     */
+    template <typename FUNCTION>
+    static void ForEachIndex(const std::size_t nItems, const unsigned int nRequestedThreads, const FUNCTION &function);
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename FUNCTION>
+inline void LArParallelHelper::ForEachIndex(const std::size_t nItems, const unsigned int nRequestedThreads, const FUNCTION &function)
+{
+    const std::size_t nThreads(std::min(static_cast<std::size_t>(LArParallelHelper::GetNumberOfThreads(nRequestedThreads)), nItems));
+
+    if (nThreads <= 1)
+    {
+        for (std::size_t index = 0; index < nItems; ++index)
+            function(index);
+
+        return;
+    }
+
+    std::atomic<std::size_t> nextIndex(0);
+    std::exception_ptr pException;
+    std::mutex exceptionMutex;
+
+    const auto worker = [&]() {
+        try
+        {
+            for (std::size_t index = nextIndex++; index < nItems; index = nextIndex++)
+                function(index);
+        }
+        catch (...)
+        {
+            // ATTN Stop handing out indices, so that all workers finish promptly
+            nextIndex = nItems;
+            const std::lock_guard<std::mutex> lock(exceptionMutex);
+
+            if (!pException)
+                pException = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nThreads - 1);
+
+    for (std::size_t iThread = 1; iThread < nThreads; ++iThread)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    if (pException)
+        std::rethrow_exception(pException);
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_PARALLEL_HELPER_H
@@ -9,6 +9,7 @@
 #include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArObjectHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 
 #include <Eigen/Dense>
 
@@ -20,17 +21,108 @@ namespace lar_content
 template <typename T>
 void LArPcaHelper::RunPca(const T &t, CartesianVector &centroid, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors)
 {
-    WeightedPointVector weightedPointVector;
+    return LArPcaHelper::RunTwoPassPca(t, centroid, outputEigenValues, outputEigenVectors);
+}
 
-    for (const auto &point : t)
-        weightedPointVector.push_back(std::make_pair(LArObjectHelper::TypeAdaptor::GetPosition(point), 1.));
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    return LArPcaHelper::RunPca(weightedPointVector, centroid, outputEigenValues, outputEigenVectors);
+void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVector &centroid, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors)
+{
+    return LArPcaHelper::RunTwoPassPca(pointVector, centroid, outputEigenValues, outputEigenVectors);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVector &centroid, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors)
+void LArPcaHelper::RunPca(
+    const MomentAccumulator &momentAccumulator, CartesianVector &centroid, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors)
+{
+    // The steps are:
+    // 1) take the mean position and covariance matrix from the single-pass moment accumulation
+    // 2) solve the symmetric 3x3 eigen problem in closed form
+    // 3) extract the eigen vectors and values
+    if (0 == momentAccumulator.GetNPoints())
+    {
+        std::cout << "LArPcaHelper::RunPca - no three dimensional hits provided" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+    }
+
+    const double sumWeight(momentAccumulator.GetSumWeight());
+
+    if (std::fabs(sumWeight) < std::numeric_limits<double>::epsilon())
+    {
+        std::cout << "LArPcaHelper::RunPca - sum of weights is zero" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+    }
+
+    centroid = momentAccumulator.GetMean();
+
+    // Using Eigen package
+    Eigen::Matrix3d sig;
+
+    sig << momentAccumulator.m_xx, momentAccumulator.m_xy, momentAccumulator.m_xz, momentAccumulator.m_xy, momentAccumulator.m_yy,
+        momentAccumulator.m_yz, momentAccumulator.m_xz, momentAccumulator.m_yz, momentAccumulator.m_zz;
+
+    sig *= 1. / sumWeight;
+
+    // ATTN Closed-form solution, rather than the iterative decomposition, which is much faster for a 3x3 matrix
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> eigenMat;
+    eigenMat.computeDirect(sig);
+
+    if (eigenMat.info() != Eigen::ComputationInfo::Success)
+    {
+        std::cout << "LArPcaHelper::RunPca - decomposition failure, nThreeDHits = " << momentAccumulator.GetNPoints() << std::endl;
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
+
+    typedef std::pair<float, size_t> EigenValColPair;
+    typedef std::vector<EigenValColPair> EigenValColVector;
+
+    EigenValColVector eigenValColVector;
+    const auto &resultEigenMat(eigenMat.eigenvalues());
+    eigenValColVector.emplace_back(resultEigenMat(0), 0);
+    eigenValColVector.emplace_back(resultEigenMat(1), 1);
+    eigenValColVector.emplace_back(resultEigenMat(2), 2);
+
+    std::sort(eigenValColVector.begin(), eigenValColVector.end(),
+        [](const EigenValColPair &left, const EigenValColPair &right) { return left.first > right.first; });
+
+    // Get the eigen values
+    outputEigenValues = CartesianVector(eigenValColVector.at(0).first, eigenValColVector.at(1).first, eigenValColVector.at(2).first);
+
+    // Get the principal axes
+    const Eigen::Matrix3d &eigenVecs(eigenMat.eigenvectors());
+
+    for (const EigenValColPair &pair : eigenValColVector)
+    {
+        // ATTN The eigen vector sign is arbitrary and differs between solvers, so fix it by making the largest component positive
+        Eigen::Vector3d eigenVec(eigenVecs.col(pair.second));
+        Eigen::Index maxIndex(0);
+        eigenVec.cwiseAbs().maxCoeff(&maxIndex);
+
+        if (eigenVec(maxIndex) < 0.)
+            eigenVec = -eigenVec;
+
+        outputEigenVectors.emplace_back(eigenVec(0), eigenVec(1), eigenVec(2));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void LArPcaHelper::RunPca(const std::vector<const T *> &pointSets, PcaResultVector &pcaResults, const unsigned int nThreads)
+{
+    pcaResults.assign(pointSets.size(), PcaResult());
+
+    LArParallelHelper::ForEachIndex(pointSets.size(), nThreads, [&](const std::size_t index) {
+        PcaResult &pcaResult(pcaResults.at(index));
+        LArPcaHelper::RunPca(*pointSets.at(index), pcaResult.m_centroid, pcaResult.m_eigenValues, pcaResult.m_eigenVectors);
+    });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void LArPcaHelper::RunTwoPassPca(const T &t, CartesianVector &centroid, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors)
 {
     // The steps are:
     // 1) do a mean normalization of the input vec points
@@ -39,7 +131,7 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
     // 4) extract the eigen vectors and values
 
     // Run through the point vector and get the mean position of all points
-    if (pointVector.empty())
+    if (t.empty())
     {
         std::cout << "LArPcaHelper::RunPca - no three dimensional hits provided" << std::endl;
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
@@ -48,10 +140,10 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
     double meanPosition[3] = {0., 0., 0.};
     double sumWeight(0.);
 
-    for (const WeightedPoint &weightedPoint : pointVector)
+    for (const auto &input : t)
     {
-        const CartesianVector &point(weightedPoint.first);
-        const double weight(weightedPoint.second);
+        const CartesianVector point(LArPcaHelper::GetPointPosition(input));
+        const double weight(LArPcaHelper::GetPointWeight(input));
 
         if (weight < 0.)
         {
@@ -84,10 +176,10 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
     double yizi(0.);
     double zi2(0.);
 
-    for (const WeightedPoint &weightedPoint : pointVector)
+    for (const auto &input : t)
     {
-        const CartesianVector &point(weightedPoint.first);
-        const double weight(weightedPoint.second);
+        const CartesianVector point(LArPcaHelper::GetPointPosition(input));
+        const double weight(LArPcaHelper::GetPointWeight(input));
         const double x(static_cast<double>((point.GetX()) - meanPosition[0]));
         const double y(static_cast<double>((point.GetY()) - meanPosition[1]));
         const double z(static_cast<double>((point.GetZ()) - meanPosition[2]));
@@ -111,7 +203,7 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
 
     if (eigenMat.info() != Eigen::ComputationInfo::Success)
     {
-        std::cout << "LArPcaHelper::RunPca - decomposition failure, nThreeDHits = " << pointVector.size() << std::endl;
+        std::cout << "LArPcaHelper::RunPca - decomposition failure, nThreeDHits = " << t.size() << std::endl;
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
     }
 
@@ -139,7 +231,102 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+CartesianVector LArPcaHelper::GetPointPosition(const T &t)
+{
+    return LArObjectHelper::TypeAdaptor::GetPosition(t);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector LArPcaHelper::GetPointPosition(const WeightedPoint &weightedPoint)
+{
+    return weightedPoint.first;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+double LArPcaHelper::GetPointWeight(const T &)
+{
+    return 1.;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double LArPcaHelper::GetPointWeight(const WeightedPoint &weightedPoint)
+{
+    return weightedPoint.second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArPcaHelper::MomentAccumulator::MomentAccumulator() :
+    m_nPoints(0),
+    m_sumWeight(0.),
+    m_mean{0., 0., 0.},
+    m_xx(0.),
+    m_xy(0.),
+    m_xz(0.),
+    m_yy(0.),
+    m_yz(0.),
+    m_zz(0.)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::MomentAccumulator::Merge(const MomentAccumulator &other)
+{
+    m_nPoints += other.m_nPoints;
+
+    if (other.m_sumWeight < std::numeric_limits<double>::min())
+        return;
+
+    if (m_sumWeight < std::numeric_limits<double>::min())
+    {
+        const unsigned int nPoints(m_nPoints);
+        *this = other;
+        m_nPoints = nPoints;
+        return;
+    }
+
+    // ATTN Pairwise combination of the moments of two disjoint point sets
+    const double sumWeight(m_sumWeight + other.m_sumWeight);
+    const double deltaX(other.m_mean[0] - m_mean[0]);
+    const double deltaY(other.m_mean[1] - m_mean[1]);
+    const double deltaZ(other.m_mean[2] - m_mean[2]);
+    const double fraction(other.m_sumWeight / sumWeight);
+    const double scale(m_sumWeight * fraction);
+
+    m_mean[0] += deltaX * fraction;
+    m_mean[1] += deltaY * fraction;
+    m_mean[2] += deltaZ * fraction;
+
+    m_xx += other.m_xx + deltaX * deltaX * scale;
+    m_xy += other.m_xy + deltaX * deltaY * scale;
+    m_xz += other.m_xz + deltaX * deltaZ * scale;
+    m_yy += other.m_yy + deltaY * deltaY * scale;
+    m_yz += other.m_yz + deltaY * deltaZ * scale;
+    m_zz += other.m_zz + deltaZ * deltaZ * scale;
+    m_sumWeight = sumWeight;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArPcaHelper::PcaResult::PcaResult() :
+    m_centroid(0.f, 0.f, 0.f),
+    m_eigenValues(0.f, 0.f, 0.f)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template void LArPcaHelper::RunPca(const CartesianPointVector &, CartesianVector &, EigenValues &, EigenVectors &);
 template void LArPcaHelper::RunPca(const CaloHitList &, CartesianVector &, EigenValues &, EigenVectors &);
+template void LArPcaHelper::RunPca(const std::vector<const CartesianPointVector *> &, PcaResultVector &, const unsigned int);
+template void LArPcaHelper::RunPca(const std::vector<const CaloHitList *> &, PcaResultVector &, const unsigned int);
 
 } // namespace lar_content
@@ -10,6 +10,9 @@
 
 #include "Objects/CartesianVector.h"
 
+#include "Pandora/StatusCodes.h"
+
+#include <limits>
 #include <vector>
 
 namespace lar_content
@@ -26,6 +29,86 @@ public:
     typedef std::pair<const pandora::CartesianVector, double> WeightedPoint;
     typedef std::vector<WeightedPoint> WeightedPointVector;
 
+    /**
+     *  @brief  MomentAccumulator class, accumulating the weighted mean and covariance of a set of points in a single pass. Accumulators
+     *          for disjoint subsets of points (e.g. filled by different threads) can be merged.
+     */
+    class MomentAccumulator
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        MomentAccumulator();
+
+        /**
+         *  @brief  Add a point
+         *
+         *  @param  point the point position
+         *  @param  weight the point weight, which must not be negative
+         */
+        void AddPoint(const pandora::CartesianVector &point, const double weight = 1.);
+
+        /**
+         *  @brief  Merge the moments accumulated by another accumulator
+         *
+         *  @param  other the other accumulator
+         */
+        void Merge(const MomentAccumulator &other);
+
+        /**
+         *  @brief  Get the number of points added
+         *
+         *  @return the number of points
+         */
+        unsigned int GetNPoints() const;
+
+        /**
+         *  @brief  Get the sum of the point weights
+         *
+         *  @return the sum of weights
+         */
+        double GetSumWeight() const;
+
+        /**
+         *  @brief  Get the weighted mean position
+         *
+         *  @return the mean position
+         */
+        pandora::CartesianVector GetMean() const;
+
+    private:
+        friend class LArPcaHelper;
+
+        unsigned int m_nPoints; ///< The number of points
+        double m_sumWeight;     ///< The sum of the point weights
+        double m_mean[3];       ///< The weighted mean position
+        double m_xx;            ///< The weighted sum of squared x deviations from the mean
+        double m_xy;            ///< The weighted sum of products of x and y deviations from the mean
+        double m_xz;            ///< The weighted sum of products of x and z deviations from the mean
+        double m_yy;            ///< The weighted sum of squared y deviations from the mean
+        double m_yz;            ///< The weighted sum of products of y and z deviations from the mean
+        double m_zz;            ///< The weighted sum of squared z deviations from the mean
+    };
+
+    /**
+     *  @brief  PcaResult class
+     */
+    class PcaResult
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        PcaResult();
+
+        pandora::CartesianVector m_centroid; ///< The centroid position
+        EigenValues m_eigenValues;           ///< The eigen values
+        EigenVectors m_eigenVectors;         ///< The eigen vectors
+    };
+
+    typedef std::vector<PcaResult> PcaResultVector;
+
     /**
      *  @brief  Run principal component analysis using input calo hits (TPC_VIEW_U,V,W or TPC_3D; all treated as 3D points)
      *
@@ -47,8 +130,138 @@ public:
      */
     static void RunPca(const WeightedPointVector &pointVector, pandora::CartesianVector &centroid, EigenValues &outputEigenValues,
         EigenVectors &outputEigenVectors);
+
+    /**
+     *  @brief  Run principal component analysis using the moments accumulated for a set of points. Opt-in alternative to the overloads
+     *          above, solving the eigen problem in closed form, in double precision. The eigen vector signs are not those of the
+     *          iterative solver used by the overloads above: each eigen vector is instead oriented so that its component of largest
+     *          magnitude is positive (the first such component, in x, y, z order, in the event of a tie).
+     *
+     *  @param  momentAccumulator the moment accumulator
+     *  @param  centroid to receive the centroid position
+     *  @param  outputEigenValues to receive the eigen values
+     *  @param  outputEigenVectors to receive the eigen vectors
+     */
+    static void RunPca(const MomentAccumulator &momentAccumulator, pandora::CartesianVector &centroid, EigenValues &outputEigenValues,
+        EigenVectors &outputEigenVectors);
+
+    /**
+     *  @brief  Run principal component analysis for each of a list of input point sets (calo hit lists or cartesian point vectors)
+     *
+     *  @param  pointSets the addresses of the input point sets
+     *  @param  pcaResults to receive the pca result for each point set, in the same order
+     *  @param  nThreads the number of threads to share the point sets between, zero to use the hardware concurrency
+     */
+    template <typename T>
+    static void RunPca(const std::vector<const T *> &pointSets, PcaResultVector &pcaResults, const unsigned int nThreads = 1);
+
+private:
+    /**
+     *  @brief  Run principal component analysis in two passes over the input points, using the iterative eigen solver
+     *
+     *  @param  t the input points, calo hits, cartesian vectors or weighted points
+     *  @param  centroid to receive the centroid position
+     *  @param  outputEigenValues to receive the eigen values
+     *  @param  outputEigenVectors to receive the eigen vectors
+     */
+    template <typename T>
+    static void RunTwoPassPca(const T &t, pandora::CartesianVector &centroid, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors);
+
+    /**
+     *  @brief  Get the position of an input point
+     *
+     *  @param  t the input point
+     *
+     *  @return the position
+     */
+    template <typename T>
+    static pandora::CartesianVector GetPointPosition(const T &t);
+
+    /**
+     *  @brief  Get the position of a weighted input point
+     *
+     *  @param  weightedPoint the weighted input point
+     *
+     *  @return the position
+     */
+    static pandora::CartesianVector GetPointPosition(const WeightedPoint &weightedPoint);
+
+    /**
+     *  @brief  Get the weight of an input point
+     *
+     *  @param  t the input point
+     *
+     *  @return the weight
+     */
+    template <typename T>
+    static double GetPointWeight(const T &t);
+
+    /**
+     *  @brief  Get the weight of a weighted input point
+     *
+     *  @param  weightedPoint the weighted input point
+     *
+     *  @return the weight
+     */
+    static double GetPointWeight(const WeightedPoint &weightedPoint);
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void LArPcaHelper::MomentAccumulator::AddPoint(const pandora::CartesianVector &point, const double weight)
+{
+    if (weight < 0.)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_ALLOWED);
+
+    ++m_nPoints;
+
+    if (weight < std::numeric_limits<double>::min())
+        return;
+
+    // ATTN Weighted Welford update, with the deviation from the old mean multiplied by the deviation from the new mean
+    m_sumWeight += weight;
+    const double deltaX(static_cast<double>(point.GetX()) - m_mean[0]);
+    const double deltaY(static_cast<double>(point.GetY()) - m_mean[1]);
+    const double deltaZ(static_cast<double>(point.GetZ()) - m_mean[2]);
+    const double fraction(weight / m_sumWeight);
+
+    m_mean[0] += deltaX * fraction;
+    m_mean[1] += deltaY * fraction;
+    m_mean[2] += deltaZ * fraction;
+
+    const double newDeltaX(static_cast<double>(point.GetX()) - m_mean[0]);
+    const double newDeltaY(static_cast<double>(point.GetY()) - m_mean[1]);
+    const double newDeltaZ(static_cast<double>(point.GetZ()) - m_mean[2]);
+
+    m_xx += weight * deltaX * newDeltaX;
+    m_xy += weight * deltaX * newDeltaY;
+    m_xz += weight * deltaX * newDeltaZ;
+    m_yy += weight * deltaY * newDeltaY;
+    m_yz += weight * deltaY * newDeltaZ;
+    m_zz += weight * deltaZ * newDeltaZ;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int LArPcaHelper::MomentAccumulator::GetNPoints() const
+{
+    return m_nPoints;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArPcaHelper::MomentAccumulator::GetSumWeight() const
+{
+    return m_sumWeight;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::CartesianVector LArPcaHelper::MomentAccumulator::GetMean() const
+{
+    return pandora::CartesianVector(m_mean[0], m_mean[1], m_mean[2]);
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_PCA_HELPER_H
@@ -30,7 +30,9 @@ EventValidationBaseAlgorithm::EventValidationBaseAlgorithm() :
     m_useSmallPrimaries(true),
     m_matchingMinSharedHits(5),
     m_matchingMinCompleteness(0.1f),
-    m_matchingMinPurity(0.5f)
+    m_matchingMinPurity(0.5f),
+    m_asynchronousOutput(false),
+    m_outputBasketSize(100)
 {
 }
 
@@ -210,6 +212,56 @@ bool EventValidationBaseAlgorithm::IsGoodMatch(const CaloHitList &trueHits, cons
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void EventValidationBaseAlgorithm::SetTreeVariable(const std::string &variableName, const int value) const
+{
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), variableName.c_str(), value));
+
+    if (m_pOutputWriter)
+        m_pOutputWriter->SetVariable(variableName, value);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventValidationBaseAlgorithm::SetTreeVariable(const std::string &variableName, const float value) const
+{
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), variableName.c_str(), value));
+
+    if (m_pOutputWriter)
+        m_pOutputWriter->SetVariable(variableName, value);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventValidationBaseAlgorithm::SetTreeVariable(const std::string &variableName, IntVector *const pValue) const
+{
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), variableName.c_str(), pValue));
+
+    if (m_pOutputWriter)
+        m_pOutputWriter->SetVariable(variableName, *pValue);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventValidationBaseAlgorithm::SetTreeVariable(const std::string &variableName, FloatVector *const pValue) const
+{
+    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), variableName.c_str(), pValue));
+
+    if (m_pOutputWriter)
+        m_pOutputWriter->SetVariable(variableName, *pValue);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventValidationBaseAlgorithm::FillTree() const
+{
+    PANDORA_MONITORING_API(FillTree(this->GetPandora(), m_treeName.c_str()));
+
+    if (m_pOutputWriter)
+        m_pOutputWriter->Fill();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode EventValidationBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "CaloHitListName", m_caloHitListName));
@@ -264,6 +316,35 @@ StatusCode EventValidationBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandl
 
         PANDORA_RETURN_RESULT_IF_AND_IF(
             STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "FileIdentifier", m_fileIdentifier));
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "AsynchronousOutput", m_asynchronousOutput));
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "OutputBasketSize", m_outputBasketSize));
+
+        if (m_asynchronousOutput)
+        {
+            // ATTN The columnar output is not a root file, so must not replace or share the file read downstream as the output tree
+            m_asynchronousOutputFileName = m_fileName + ".larvalid";
+
+            PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+                XmlHelper::ReadValue(xmlHandle, "AsynchronousOutputFile", m_asynchronousOutputFileName));
+
+            if (m_asynchronousOutputFileName == m_fileName)
+            {
+                std::cout << "EventValidationBaseAlgorithm::ReadSettings - AsynchronousOutputFile must differ from OutputFile" << std::endl;
+                return STATUS_CODE_INVALID_PARAMETER;
+            }
+
+            if (0 == m_outputBasketSize)
+            {
+                std::cout << "EventValidationBaseAlgorithm::ReadSettings - OutputBasketSize must be greater than zero" << std::endl;
+                return STATUS_CODE_INVALID_PARAMETER;
+            }
+
+            m_pOutputWriter = std::make_unique<ValidationOutputWriter>(m_asynchronousOutputFileName, m_treeName, m_outputBasketSize);
+        }
     }
 
     return STATUS_CODE_SUCCESS;
@@ -12,11 +12,14 @@
 
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 
+#include "larpandoracontent/LArMonitoring/ValidationOutputWriter.h"
+
 #ifdef MONITORING
 #include "PandoraMonitoringApi.h"
 #endif
 
 #include <map>
+#include <memory>
 
 namespace lar_content
 {
@@ -187,6 +190,45 @@ protected:
      */
     bool IsGoodMatch(const pandora::CaloHitList &trueHits, const pandora::CaloHitList &recoHits, const pandora::CaloHitList &sharedHits) const;
 
+    /**
+     *  @brief  Set a variable in the current output tree entry, via the monitoring api and, if configured, the asynchronous writer
+     *
+     *  @param  variableName the variable name
+     *  @param  value the variable value
+     */
+    void SetTreeVariable(const std::string &variableName, const int value) const;
+
+    /**
+     *  @brief  Set a variable in the current output tree entry, via the monitoring api and, if configured, the asynchronous writer
+     *
+     *  @param  variableName the variable name
+     *  @param  value the variable value
+     */
+    void SetTreeVariable(const std::string &variableName, const float value) const;
+
+    /**
+     *  @brief  Set a vector variable in the current output tree entry, via the monitoring api and, if configured, the asynchronous
+     *          writer (which copies the vector)
+     *
+     *  @param  variableName the variable name
+     *  @param  pValue the address of the variable value
+     */
+    void SetTreeVariable(const std::string &variableName, pandora::IntVector *const pValue) const;
+
+    /**
+     *  @brief  Set a vector variable in the current output tree entry, via the monitoring api and, if configured, the asynchronous
+     *          writer (which copies the vector)
+     *
+     *  @param  variableName the variable name
+     *  @param  pValue the address of the variable value
+     */
+    void SetTreeVariable(const std::string &variableName, pandora::FloatVector *const pValue) const;
+
+    /**
+     *  @brief  Fill the output tree with the current entry and, if configured, queue a snapshot of the entry for the asynchronous writer
+     */
+    void FillTree() const;
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     LArMCParticleHelper::PrimaryParameters m_primaryParameters; ///< The mc particle primary selection parameters
@@ -233,6 +275,11 @@ private:
     float m_matchingMinPurity;            ///< The minimum particle purity to declare a match
 
     std::string m_fileName; ///< Name of output file
+
+    bool m_asynchronousOutput;                               ///< Whether to also write tree entries, in columnar baskets, from a background thread
+    std::string m_asynchronousOutputFileName;                ///< Name of the columnar output file, which must differ from the output file
+    unsigned int m_outputBasketSize;                         ///< The number of entries per basket for asynchronous output
+    std::unique_ptr<ValidationOutputWriter> m_pOutputWriter; ///< The asynchronous output writer, if configured
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,329 @@
+/**
+ *  @file   larpandoracontent/LArMonitoring/OverlapStorageBenchmarkAlgorithm.cc
+ *
+ *  @brief  Implementation of the overlap storage benchmark algorithm.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+
+#include "larpandoracontent/LArMonitoring/OverlapStorageBenchmarkAlgorithm.h"
+
+#include "larpandoracontent/LArObjects/LArShowerOverlapResult.h"
+#include "larpandoracontent/LArObjects/LArTrackOverlapResult.h"
+
+#include <algorithm>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+OverlapStorageBenchmarkAlgorithm::OverlapStorageBenchmarkAlgorithm() : m_nRepetitions(10)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+OverlapStorageBenchmarkAlgorithm::~OverlapStorageBenchmarkAlgorithm()
+{
+    if (!m_reportFileName.empty() && !m_profiler.WriteReport(m_reportFileName))
+        std::cout << "OverlapStorageBenchmarkAlgorithm: unable to write report " << m_reportFileName << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+OverlapStorageBenchmarkAlgorithm::OperationCounts::OperationCounts() :
+    m_nFound(0),
+    m_nIterated(0),
+    m_nConnected(0),
+    m_nUnambiguous(0),
+    m_nRemaining(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool OverlapStorageBenchmarkAlgorithm::OperationCounts::operator==(const OperationCounts &rhs) const
+{
+    return ((m_nFound == rhs.m_nFound) && (m_nIterated == rhs.m_nIterated) && (m_nConnected == rhs.m_nConnected) &&
+        (m_nUnambiguous == rhs.m_nUnambiguous) && (m_nRemaining == rhs.m_nRemaining));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+float OverlapStorageBenchmarkAlgorithm::MakeOverlapResult(
+    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
+{
+    return static_cast<float>(pClusterU->GetNCaloHits() + pClusterV->GetNCaloHits() + pClusterW->GetNCaloHits());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+TrackOverlapResult OverlapStorageBenchmarkAlgorithm::MakeOverlapResult(
+    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
+{
+    const unsigned int nSamplingPoints(pClusterU->GetNCaloHits() + pClusterV->GetNCaloHits() + pClusterW->GetNCaloHits());
+    const unsigned int nMatchedSamplingPoints(
+        std::min(pClusterU->GetNCaloHits(), std::min(pClusterV->GetNCaloHits(), pClusterW->GetNCaloHits())));
+
+    return TrackOverlapResult(
+        nMatchedSamplingPoints, std::max(1u, nSamplingPoints), static_cast<float>(nSamplingPoints - nMatchedSamplingPoints));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+XOverlap OverlapStorageBenchmarkAlgorithm::MakeOverlapResult(
+    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
+{
+    float uMinX(0.f), uMaxX(0.f), vMinX(0.f), vMaxX(0.f), wMinX(0.f), wMaxX(0.f);
+    pClusterU->GetClusterSpanX(uMinX, uMaxX);
+    pClusterV->GetClusterSpanX(vMinX, vMaxX);
+    pClusterW->GetClusterSpanX(wMinX, wMaxX);
+
+    const float xOverlapSpan(std::min(uMaxX, std::min(vMaxX, wMaxX)) - std::max(uMinX, std::max(vMinX, wMinX)));
+    return XOverlap(uMinX, uMaxX, vMinX, vMaxX, wMinX, wMaxX, xOverlapSpan);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+TransverseOverlapResult OverlapStorageBenchmarkAlgorithm::MakeOverlapResult(
+    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
+{
+    const TrackOverlapResult trackOverlapResult(
+        OverlapStorageBenchmarkAlgorithm::MakeOverlapResult<TrackOverlapResult>(pClusterU, pClusterV, pClusterW));
+
+    return TransverseOverlapResult(trackOverlapResult.GetNMatchedSamplingPoints(), trackOverlapResult.GetNSamplingPoints(),
+        trackOverlapResult.GetChi2(), OverlapStorageBenchmarkAlgorithm::MakeOverlapResult<XOverlap>(pClusterU, pClusterV, pClusterW));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+LongitudinalOverlapResult OverlapStorageBenchmarkAlgorithm::MakeOverlapResult(
+    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
+{
+    const TrackOverlapResult trackOverlapResult(
+        OverlapStorageBenchmarkAlgorithm::MakeOverlapResult<TrackOverlapResult>(pClusterU, pClusterV, pClusterW));
+
+    return LongitudinalOverlapResult(trackOverlapResult, 0.5f * trackOverlapResult.GetChi2(), 0.5f * trackOverlapResult.GetChi2());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+FragmentOverlapResult OverlapStorageBenchmarkAlgorithm::MakeOverlapResult(
+    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
+{
+    CaloHitList caloHitList;
+    pClusterU->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+    return FragmentOverlapResult(OverlapStorageBenchmarkAlgorithm::MakeOverlapResult<TrackOverlapResult>(pClusterU, pClusterV, pClusterW),
+        caloHitList, ClusterList(1, pClusterU));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+ShowerOverlapResult OverlapStorageBenchmarkAlgorithm::MakeOverlapResult(
+    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
+{
+    const TrackOverlapResult trackOverlapResult(
+        OverlapStorageBenchmarkAlgorithm::MakeOverlapResult<TrackOverlapResult>(pClusterU, pClusterV, pClusterW));
+
+    return ShowerOverlapResult(trackOverlapResult.GetNMatchedSamplingPoints(), trackOverlapResult.GetNSamplingPoints(),
+        OverlapStorageBenchmarkAlgorithm::MakeOverlapResult<XOverlap>(pClusterU, pClusterV, pClusterW));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <>
+DeltaRayOverlapResult OverlapStorageBenchmarkAlgorithm::MakeOverlapResult(
+    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
+{
+    const TrackOverlapResult trackOverlapResult(
+        OverlapStorageBenchmarkAlgorithm::MakeOverlapResult<TrackOverlapResult>(pClusterU, pClusterV, pClusterW));
+
+    return DeltaRayOverlapResult(trackOverlapResult.GetNMatchedSamplingPoints(), trackOverlapResult.GetNSamplingPoints(),
+        trackOverlapResult.GetChi2(), OverlapStorageBenchmarkAlgorithm::MakeOverlapResult<XOverlap>(pClusterU, pClusterV, pClusterW), PfoList());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode OverlapStorageBenchmarkAlgorithm::Run()
+{
+    ClusterVector clusterVectorU, clusterVectorV, clusterVectorW;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetClusters(m_inputClusterListNameU, clusterVectorU));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetClusters(m_inputClusterListNameV, clusterVectorV));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetClusters(m_inputClusterListNameW, clusterVectorW));
+
+    m_profiler.StartEvent();
+    this->RunBenchmark<float>("float", clusterVectorU, clusterVectorV, clusterVectorW);
+    this->RunBenchmark<TransverseOverlapResult>("TransverseOverlapResult", clusterVectorU, clusterVectorV, clusterVectorW);
+    this->RunBenchmark<LongitudinalOverlapResult>("LongitudinalOverlapResult", clusterVectorU, clusterVectorV, clusterVectorW);
+    this->RunBenchmark<FragmentOverlapResult>("FragmentOverlapResult", clusterVectorU, clusterVectorV, clusterVectorW);
+    this->RunBenchmark<ShowerOverlapResult>("ShowerOverlapResult", clusterVectorU, clusterVectorV, clusterVectorW);
+    this->RunBenchmark<DeltaRayOverlapResult>("DeltaRayOverlapResult", clusterVectorU, clusterVectorV, clusterVectorW);
+    m_profiler.EndEvent();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapStorageBenchmarkAlgorithm::RunBenchmark(
+    const std::string &typeName, const ClusterVector &clusterVectorU, const ClusterVector &clusterVectorV, const ClusterVector &clusterVectorW)
+{
+    typedef OverlapTensor<T> TensorType;
+
+    // ATTN Only trios of clusters with overlapping x spans are filled, so that the tensor is as sparse as in the matching algorithms
+    typename TensorType::ElementList inputElements;
+
+    for (const Cluster *const pClusterU : clusterVectorU)
+    {
+        for (const Cluster *const pClusterV : clusterVectorV)
+        {
+            for (const Cluster *const pClusterW : clusterVectorW)
+            {
+                const XOverlap xOverlap(OverlapStorageBenchmarkAlgorithm::MakeOverlapResult<XOverlap>(pClusterU, pClusterV, pClusterW));
+
+                if (xOverlap.GetXOverlapSpan() > 0.f)
+                    inputElements.push_back(typename TensorType::Element(
+                        pClusterU, pClusterV, pClusterW, OverlapStorageBenchmarkAlgorithm::MakeOverlapResult<T>(pClusterU, pClusterV, pClusterW)));
+            }
+        }
+    }
+
+    for (unsigned int iRepetition = 0; iRepetition < m_nRepetitions; ++iRepetition)
+    {
+        TensorType nestedTensor, flatTensor;
+        flatTensor.SetUseFlatStorage(true);
+
+        const OperationCounts nestedCounts(this->TimeOperations<T>(typeName + "::Nested", inputElements, clusterVectorU, nestedTensor));
+        const OperationCounts flatCounts(this->TimeOperations<T>(typeName + "::Flat", inputElements, clusterVectorU, flatTensor));
+
+        if (!(nestedCounts == flatCounts) || (inputElements.size() != nestedCounts.m_nFound) || (inputElements.size() != nestedCounts.m_nIterated) ||
+            (nestedCounts.m_nUnambiguous > nestedCounts.m_nConnected) || (0 != nestedCounts.m_nRemaining))
+        {
+            std::cout << "OverlapStorageBenchmarkAlgorithm: inconsistent " << typeName << " results " << inputElements.size() << ", "
+                      << nestedCounts.m_nFound << ", " << flatCounts.m_nFound << ", " << nestedCounts.m_nIterated << ", "
+                      << flatCounts.m_nIterated << std::endl;
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+OverlapStorageBenchmarkAlgorithm::OperationCounts OverlapStorageBenchmarkAlgorithm::TimeOperations(const std::string &stepName,
+    const typename OverlapTensor<T>::ElementList &inputElements, const ClusterVector &clusterVectorU, OverlapTensor<T> &overlapTensor)
+{
+    typedef OverlapTensor<T> TensorType;
+    OperationCounts operationCounts;
+
+    {
+        const ReconstructionProfiler::ScopedTimer scopedTimer(&m_profiler, stepName + "::Set");
+
+        for (const typename TensorType::Element &element : inputElements)
+            overlapTensor.SetOverlapResult(element.GetClusterU(), element.GetClusterV(), element.GetClusterW(), element.GetOverlapResult());
+    }
+
+    {
+        const ReconstructionProfiler::ScopedTimer scopedTimer(&m_profiler, stepName + "::Get");
+
+        for (const typename TensorType::Element &element : inputElements)
+        {
+            const T &overlapResult(overlapTensor.GetOverlapResult(element.GetClusterU(), element.GetClusterV(), element.GetClusterW()));
+
+            if (!(overlapResult < element.GetOverlapResult()) && !(element.GetOverlapResult() < overlapResult))
+                ++operationCounts.m_nFound;
+        }
+    }
+
+    {
+        const ReconstructionProfiler::ScopedTimer scopedTimer(&m_profiler, stepName + "::Iterate");
+        typename TensorType::ElementList elementList;
+        overlapTensor.GetAllElements(false, elementList);
+        operationCounts.m_nIterated = elementList.size();
+    }
+
+    {
+        const ReconstructionProfiler::ScopedTimer scopedTimer(&m_profiler, stepName + "::GetConnectedElements");
+        ClusterVector sortedKeyClusters;
+        overlapTensor.GetSortedKeyClusters(sortedKeyClusters);
+
+        for (const Cluster *const pKeyCluster : sortedKeyClusters)
+        {
+            typename TensorType::ElementList elementList;
+            overlapTensor.GetConnectedElements(pKeyCluster, false, elementList);
+            operationCounts.m_nConnected += elementList.size();
+        }
+    }
+
+    {
+        const ReconstructionProfiler::ScopedTimer scopedTimer(&m_profiler, stepName + "::GetUnambiguousElements");
+        typename TensorType::ElementList elementList;
+        overlapTensor.GetUnambiguousElements(false, elementList);
+        operationCounts.m_nUnambiguous = elementList.size();
+    }
+
+    {
+        const ReconstructionProfiler::ScopedTimer scopedTimer(&m_profiler, stepName + "::RemoveCluster");
+
+        for (const Cluster *const pClusterU : clusterVectorU)
+            overlapTensor.RemoveCluster(pClusterU);
+    }
+
+    typename TensorType::ElementList remainingElements;
+    overlapTensor.GetAllElements(false, remainingElements);
+    operationCounts.m_nRemaining = remainingElements.size();
+
+    return operationCounts;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode OverlapStorageBenchmarkAlgorithm::GetClusters(const std::string &clusterListName, ClusterVector &clusterVector) const
+{
+    const ClusterList *pClusterList(nullptr);
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_INITIALIZED, !=, PandoraContentApi::GetList(*this, clusterListName, pClusterList));
+
+    if (pClusterList)
+        clusterVector.insert(clusterVector.end(), pClusterList->begin(), pClusterList->end());
+
+    std::sort(clusterVector.begin(), clusterVector.end(), LArClusterHelper::SortByNHits);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode OverlapStorageBenchmarkAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameU", m_inputClusterListNameU));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameV", m_inputClusterListNameV));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameW", m_inputClusterListNameW));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "ReportFileName", m_reportFileName));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NRepetitions", m_nRepetitions));
+
+    if (0 == m_nRepetitions)
+    {
+        std::cout << "OverlapStorageBenchmarkAlgorithm: NRepetitions must be greater than zero" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
@@ -0,0 +1,146 @@
+/**
+ *  @file   larpandoracontent/LArMonitoring/OverlapStorageBenchmarkAlgorithm.h
+ *
+ *  @brief  Header file for the overlap storage benchmark algorithm.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_OVERLAP_STORAGE_BENCHMARK_ALGORITHM_H
+#define LAR_OVERLAP_STORAGE_BENCHMARK_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+#include "larpandoracontent/LArControlFlow/ReconstructionProfiler.h"
+
+#include "larpandoracontent/LArObjects/LArOverlapTensor.h"
+
+#include <cstddef>
+#include <string>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  OverlapStorageBenchmarkAlgorithm class. For each of the overlap result types for which OverlapTensor is instantiated, fills
+ *          a tensor with a result for every trio of u, v and w clusters whose x spans overlap, then times the set, get, iterate, connected
+ *          and unambiguous element queries and remove operations of an OverlapTensor using its default nested map storage against those
+ *          of an OverlapTensor using flat storage, checking that both give the same results. Timings are written as a csv report. This
+ *          algorithm is not registered by LArContent and must be registered by a benchmarking application, using its Factory.
+ */
+class OverlapStorageBenchmarkAlgorithm : public pandora::Algorithm
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    OverlapStorageBenchmarkAlgorithm();
+
+    /**
+     *  @brief  Destructor, writing the timing report
+     */
+    ~OverlapStorageBenchmarkAlgorithm();
+
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public pandora::AlgorithmFactory
+    {
+    public:
+        pandora::Algorithm *CreateAlgorithm() const;
+    };
+
+private:
+    /**
+     *  @brief  OperationCounts class, recording the outcome of the timed operations on an overlap tensor
+     */
+    class OperationCounts
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        OperationCounts();
+
+        /**
+         *  @brief  Whether the counts are identical to those of another set of timed operations
+         *
+         *  @param  rhs the other operation counts
+         */
+        bool operator==(const OperationCounts &rhs) const;
+
+        std::size_t m_nFound;       ///< The number of input overlap results retrieved unchanged
+        std::size_t m_nIterated;    ///< The number of elements found when iterating over the tensor
+        std::size_t m_nConnected;   ///< The total number of connected elements, summed over the key clusters
+        std::size_t m_nUnambiguous; ///< The number of unambiguous elements
+        std::size_t m_nRemaining;   ///< The number of elements remaining after removing the u clusters
+    };
+
+    pandora::StatusCode Run();
+
+    /**
+     *  @brief  Run the benchmark for a given overlap result type
+     *
+     *  @param  typeName the overlap result type name, used to label the timing steps
+     *  @param  clusterVectorU the u clusters
+     *  @param  clusterVectorV the v clusters
+     *  @param  clusterVectorW the w clusters
+     */
+    template <typename T>
+    void RunBenchmark(const std::string &typeName, const pandora::ClusterVector &clusterVectorU, const pandora::ClusterVector &clusterVectorV,
+        const pandora::ClusterVector &clusterVectorW);
+
+    /**
+     *  @brief  Time the operations on a given overlap tensor
+     *
+     *  @param  stepName the name used to label the timing steps
+     *  @param  inputElements the elements with which to fill the tensor
+     *  @param  clusterVectorU the u clusters, to be removed from the tensor
+     *  @param  overlapTensor the overlap tensor, which must be empty
+     *
+     *  @return the operation counts
+     */
+    template <typename T>
+    OperationCounts TimeOperations(const std::string &stepName, const typename OverlapTensor<T>::ElementList &inputElements,
+        const pandora::ClusterVector &clusterVectorU, OverlapTensor<T> &overlapTensor);
+
+    /**
+     *  @brief  Make a representative overlap result for a trio of clusters
+     *
+     *  @param  pClusterU address of cluster u
+     *  @param  pClusterV address of cluster v
+     *  @param  pClusterW address of cluster w
+     *
+     *  @return the overlap result
+     */
+    template <typename T>
+    static T MakeOverlapResult(
+        const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
+
+    /**
+     *  @brief  Get the clusters in a named list, ordered by number of hits
+     *
+     *  @param  clusterListName the cluster list name
+     *  @param  clusterVector to receive the clusters
+     */
+    pandora::StatusCode GetClusters(const std::string &clusterListName, pandora::ClusterVector &clusterVector) const;
+
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    std::string m_inputClusterListNameU; ///< The name of the u cluster list
+    std::string m_inputClusterListNameV; ///< The name of the v cluster list
+    std::string m_inputClusterListNameW; ///< The name of the w cluster list
+    unsigned int m_nRepetitions;         ///< The number of times to repeat each benchmark per event
+    std::string m_reportFileName;        ///< The name of the csv timing report file
+    ReconstructionProfiler m_profiler;   ///< The profiler accumulating the timings
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::Algorithm *OverlapStorageBenchmarkAlgorithm::Factory::CreateAlgorithm() const
+{
+    return new OverlapStorageBenchmarkAlgorithm();
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_OVERLAP_STORAGE_BENCHMARK_ALGORITHM_H
@@ -392,63 +392,62 @@ void TestBeamHierarchyEventValidationAlgorithm::ProcessOutput(
 
         if (fillTree)
         {
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "fileIdentifier", m_fileIdentifier));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "eventNumber", m_eventNumber - 1));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcNuanceCode", mcNuanceCode));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isBeamParticle", isBeamParticle));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCosmicRay", isCosmicRay));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetPrimaries", nTargetPrimaries));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexX", targetVertexX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexY", targetVertexY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexZ", targetVertexZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexX", recoVertexX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexY", recoVertexY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexZ", recoVertexZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryId", &mcPrimaryId));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPdg", &mcPrimaryPdg));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryTier", &mcPrimaryTier));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryE", &mcPrimaryE));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPX", &mcPrimaryPX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPY", &mcPrimaryPY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPZ", &mcPrimaryPZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxX", &mcPrimaryVtxX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxY", &mcPrimaryVtxY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxZ", &mcPrimaryVtxZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndX", &mcPrimaryEndX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndY", &mcPrimaryEndY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndZ", &mcPrimaryEndZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsTotal", &nMCHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsU", &nMCHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsV", &nMCHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsW", &nMCHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedPfos", &nPrimaryMatchedPfos));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedTBHierarchyPfos", &nPrimaryMatchedTBHierarchyPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedCRPfos", &nPrimaryMatchedCRPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoId", &bestMatchPfoId));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoPdg", &bestMatchPfoPdg));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoTier", &bestMatchPfoTier));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsTotal", &bestMatchPfoNHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsU", &bestMatchPfoNHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsV", &bestMatchPfoNHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsW", &bestMatchPfoNHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsTotal", &bestMatchPfoNSharedHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsU", &bestMatchPfoNSharedHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsV", &bestMatchPfoNSharedHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsW", &bestMatchPfoNSharedHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoX0", &bestMatchPfoX0));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetMatches", nTargetMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetTBHierarchyMatches", nTargetTBHierarchyMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetCRMatches", nTargetCRMatches));
-
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoIsTestBeam", &bestMatchPfoIsTestBeam));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoIsTestBeamHierarchy", &bestMatchPfoIsTestBeamHierarchy));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoRecoTBId", &bestMatchPfoRecoTBId));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetGoodTBHierarchyMatches", nTargetGoodTBHierarchyMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetTBHierarchySplits", nTargetTBHierarchySplits));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetTBHierarchyLosses", nTargetTBHierarchyLosses));
+#ifdef MONITORING
+            this->SetTreeVariable("fileIdentifier", m_fileIdentifier);
+            this->SetTreeVariable("eventNumber", m_eventNumber - 1);
+            this->SetTreeVariable("mcNuanceCode", mcNuanceCode);
+            this->SetTreeVariable("isBeamParticle", isBeamParticle);
+            this->SetTreeVariable("isCosmicRay", isCosmicRay);
+            this->SetTreeVariable("nTargetPrimaries", nTargetPrimaries);
+            this->SetTreeVariable("targetVertexX", targetVertexX);
+            this->SetTreeVariable("targetVertexY", targetVertexY);
+            this->SetTreeVariable("targetVertexZ", targetVertexZ);
+            this->SetTreeVariable("recoVertexX", recoVertexX);
+            this->SetTreeVariable("recoVertexY", recoVertexY);
+            this->SetTreeVariable("recoVertexZ", recoVertexZ);
+            this->SetTreeVariable("mcPrimaryId", &mcPrimaryId);
+            this->SetTreeVariable("mcPrimaryPdg", &mcPrimaryPdg);
+            this->SetTreeVariable("mcPrimaryTier", &mcPrimaryTier);
+            this->SetTreeVariable("mcPrimaryE", &mcPrimaryE);
+            this->SetTreeVariable("mcPrimaryPX", &mcPrimaryPX);
+            this->SetTreeVariable("mcPrimaryPY", &mcPrimaryPY);
+            this->SetTreeVariable("mcPrimaryPZ", &mcPrimaryPZ);
+            this->SetTreeVariable("mcPrimaryVtxX", &mcPrimaryVtxX);
+            this->SetTreeVariable("mcPrimaryVtxY", &mcPrimaryVtxY);
+            this->SetTreeVariable("mcPrimaryVtxZ", &mcPrimaryVtxZ);
+            this->SetTreeVariable("mcPrimaryEndX", &mcPrimaryEndX);
+            this->SetTreeVariable("mcPrimaryEndY", &mcPrimaryEndY);
+            this->SetTreeVariable("mcPrimaryEndZ", &mcPrimaryEndZ);
+            this->SetTreeVariable("mcPrimaryNHitsTotal", &nMCHitsTotal);
+            this->SetTreeVariable("mcPrimaryNHitsU", &nMCHitsU);
+            this->SetTreeVariable("mcPrimaryNHitsV", &nMCHitsV);
+            this->SetTreeVariable("mcPrimaryNHitsW", &nMCHitsW);
+            this->SetTreeVariable("nPrimaryMatchedPfos", &nPrimaryMatchedPfos);
+            this->SetTreeVariable("nPrimaryMatchedTBHierarchyPfos", &nPrimaryMatchedTBHierarchyPfos);
+            this->SetTreeVariable("nPrimaryMatchedCRPfos", &nPrimaryMatchedCRPfos);
+            this->SetTreeVariable("bestMatchPfoId", &bestMatchPfoId);
+            this->SetTreeVariable("bestMatchPfoPdg", &bestMatchPfoPdg);
+            this->SetTreeVariable("bestMatchPfoTier", &bestMatchPfoTier);
+            this->SetTreeVariable("bestMatchPfoNHitsTotal", &bestMatchPfoNHitsTotal);
+            this->SetTreeVariable("bestMatchPfoNHitsU", &bestMatchPfoNHitsU);
+            this->SetTreeVariable("bestMatchPfoNHitsV", &bestMatchPfoNHitsV);
+            this->SetTreeVariable("bestMatchPfoNHitsW", &bestMatchPfoNHitsW);
+            this->SetTreeVariable("bestMatchPfoNSharedHitsTotal", &bestMatchPfoNSharedHitsTotal);
+            this->SetTreeVariable("bestMatchPfoNSharedHitsU", &bestMatchPfoNSharedHitsU);
+            this->SetTreeVariable("bestMatchPfoNSharedHitsV", &bestMatchPfoNSharedHitsV);
+            this->SetTreeVariable("bestMatchPfoNSharedHitsW", &bestMatchPfoNSharedHitsW);
+            this->SetTreeVariable("bestMatchPfoX0", &bestMatchPfoX0);
+            this->SetTreeVariable("nTargetMatches", nTargetMatches);
+            this->SetTreeVariable("nTargetTBHierarchyMatches", nTargetTBHierarchyMatches);
+            this->SetTreeVariable("nTargetCRMatches", nTargetCRMatches);
+
+            this->SetTreeVariable("bestMatchPfoIsTestBeam", &bestMatchPfoIsTestBeam);
+            this->SetTreeVariable("bestMatchPfoIsTestBeamHierarchy", &bestMatchPfoIsTestBeamHierarchy);
+            this->SetTreeVariable("bestMatchPfoRecoTBId", &bestMatchPfoRecoTBId);
+            this->SetTreeVariable("nTargetGoodTBHierarchyMatches", nTargetGoodTBHierarchyMatches);
+            this->SetTreeVariable("nTargetTBHierarchySplits", nTargetTBHierarchySplits);
+            this->SetTreeVariable("nTargetTBHierarchyLosses", nTargetTBHierarchyLosses);
+#endif
         }
 
         if (isCosmicRay || isLastTestBeamLeading)
@@ -525,15 +524,17 @@ void TestBeamHierarchyEventValidationAlgorithm::ProcessOutput(
 
             if (fillTree)
             {
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "interactionType", interactionTypeInt));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrectTBHierarchy", isCorrectTBHierarchy));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrectCR", isCorrectCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isFakeTBHierarchy", isFakeTBHierarchy));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isFakeCR", isFakeCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isSplitTBHierarchy", isSplitTBHierarchy));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isSplitCR", isSplitCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isLost", isLost));
-                PANDORA_MONITORING_API(FillTree(this->GetPandora(), m_treeName.c_str()));
+#ifdef MONITORING
+                this->SetTreeVariable("interactionType", interactionTypeInt);
+                this->SetTreeVariable("isCorrectTBHierarchy", isCorrectTBHierarchy);
+                this->SetTreeVariable("isCorrectCR", isCorrectCR);
+                this->SetTreeVariable("isFakeTBHierarchy", isFakeTBHierarchy);
+                this->SetTreeVariable("isFakeCR", isFakeCR);
+                this->SetTreeVariable("isSplitTBHierarchy", isSplitTBHierarchy);
+                this->SetTreeVariable("isSplitCR", isSplitCR);
+                this->SetTreeVariable("isLost", isLost);
+                this->FillTree();
+#endif
             }
 
             targetSS.str(std::string());
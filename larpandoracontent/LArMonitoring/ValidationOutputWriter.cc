@@ -0,0 +1,236 @@
+/**
+ *  @file   larpandoracontent/LArMonitoring/ValidationOutputWriter.cc
+ *
+ *  @brief  Implementation of the asynchronous, columnar validation output writer class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArMonitoring/ValidationOutputWriter.h"
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+ValidationOutputWriter::ValidationOutputWriter(const std::string &fileName, const std::string &treeName, const unsigned int basketSize) :
+    m_file(fileName, std::ios::out | std::ios::binary | std::ios::trunc),
+    m_fileName(fileName),
+    m_basketSize(std::max(1u, basketSize)),
+    m_isStopping(false)
+{
+    if (!m_file.is_open())
+    {
+        std::cout << "ValidationOutputWriter: Unable to open file " << fileName << std::endl;
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+
+    const std::string magic("LARVALID");
+    m_file.write(magic.c_str(), magic.size());
+    this->WriteValue(static_cast<uint32_t>(1));
+    this->WriteString(treeName);
+
+    m_pendingRows.reserve(m_basketSize);
+    m_thread = std::thread(&ValidationOutputWriter::Process, this);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ValidationOutputWriter::~ValidationOutputWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+
+    m_condition.notify_one();
+
+    if (m_thread.joinable())
+        m_thread.join();
+
+    m_file.flush();
+
+    if (!m_file.good())
+        std::cout << "ValidationOutputWriter: Error writing validation output to file " << m_fileName << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ValidationOutputWriter::SetVariable(const std::string &variableName, const int value)
+{
+    m_currentRow.m_intValues[variableName] = value;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ValidationOutputWriter::SetVariable(const std::string &variableName, const float value)
+{
+    m_currentRow.m_floatValues[variableName] = value;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ValidationOutputWriter::SetVariable(const std::string &variableName, const IntVector &value)
+{
+    m_currentRow.m_intVectorValues[variableName] = value;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ValidationOutputWriter::SetVariable(const std::string &variableName, const FloatVector &value)
+{
+    m_currentRow.m_floatVectorValues[variableName] = value;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ValidationOutputWriter::Fill()
+{
+    bool isBasketFull(false);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pendingRows.push_back(std::move(m_currentRow));
+        isBasketFull = (m_pendingRows.size() >= m_basketSize);
+    }
+
+    m_currentRow = Row();
+
+    if (isBasketFull)
+        m_condition.notify_one();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ValidationOutputWriter::Process()
+{
+    RowVector basket;
+    bool isStopping(false);
+
+    while (!isStopping)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this] { return (m_isStopping || (m_pendingRows.size() >= m_basketSize)); });
+
+            // ATTN Swap out the whole queue, so that the calling thread only ever waits for this swap, never for file output
+            basket.swap(m_pendingRows);
+            m_pendingRows.reserve(m_basketSize);
+            isStopping = m_isStopping;
+        }
+
+        if (!basket.empty())
+            this->WriteBasket(basket);
+
+        basket.clear();
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ValidationOutputWriter::WriteBasket(const RowVector &rowVector)
+{
+    StringSet intNames, floatNames, intVectorNames, floatVectorNames;
+
+    for (const Row &row : rowVector)
+    {
+        for (const auto &mapEntry : row.m_intValues)
+            (void)intNames.insert(mapEntry.first);
+        for (const auto &mapEntry : row.m_floatValues)
+            (void)floatNames.insert(mapEntry.first);
+        for (const auto &mapEntry : row.m_intVectorValues)
+            (void)intVectorNames.insert(mapEntry.first);
+        for (const auto &mapEntry : row.m_floatVectorValues)
+            (void)floatVectorNames.insert(mapEntry.first);
+    }
+
+    this->WriteValue(static_cast<uint32_t>(rowVector.size()));
+    this->WriteValue(static_cast<uint32_t>(intNames.size() + floatNames.size() + intVectorNames.size() + floatVectorNames.size()));
+
+    this->WriteScalarColumns<int>(
+        rowVector, intNames, 0, [](const Row &row) -> const std::map<std::string, int> & { return row.m_intValues; });
+    this->WriteScalarColumns<float>(
+        rowVector, floatNames, 1, [](const Row &row) -> const std::map<std::string, float> & { return row.m_floatValues; });
+    this->WriteVectorColumns<int>(
+        rowVector, intVectorNames, 2, [](const Row &row) -> const std::map<std::string, IntVector> & { return row.m_intVectorValues; });
+    this->WriteVectorColumns<float>(rowVector, floatVectorNames, 3,
+        [](const Row &row) -> const std::map<std::string, FloatVector> & { return row.m_floatVectorValues; });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T, typename GETTER>
+void ValidationOutputWriter::WriteScalarColumns(
+    const RowVector &rowVector, const StringSet &columnNames, const uint8_t columnType, const GETTER &getValues)
+{
+    std::vector<T> column(rowVector.size());
+
+    for (const std::string &columnName : columnNames)
+    {
+        // ATTN Variables not set for a given row are written as zero, not carried over from the previous row as for an unset tree branch
+        for (size_t iRow = 0; iRow < rowVector.size(); ++iRow)
+        {
+            const auto &values(getValues(rowVector.at(iRow)));
+            const auto iter(values.find(columnName));
+            column[iRow] = (values.end() != iter) ? iter->second : T(0);
+        }
+
+        this->WriteString(columnName);
+        this->WriteValue(columnType);
+        m_file.write(reinterpret_cast<const char *>(column.data()), column.size() * sizeof(T));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T, typename GETTER>
+void ValidationOutputWriter::WriteVectorColumns(
+    const RowVector &rowVector, const StringSet &columnNames, const uint8_t columnType, const GETTER &getValues)
+{
+    std::vector<uint32_t> sizes(rowVector.size());
+    std::vector<T> elements;
+
+    for (const std::string &columnName : columnNames)
+    {
+        elements.clear();
+
+        for (size_t iRow = 0; iRow < rowVector.size(); ++iRow)
+        {
+            const auto &values(getValues(rowVector.at(iRow)));
+            const auto iter(values.find(columnName));
+            sizes[iRow] = (values.end() != iter) ? static_cast<uint32_t>(iter->second.size()) : 0;
+
+            if (values.end() != iter)
+                elements.insert(elements.end(), iter->second.begin(), iter->second.end());
+        }
+
+        this->WriteString(columnName);
+        this->WriteValue(columnType);
+        m_file.write(reinterpret_cast<const char *>(sizes.data()), sizes.size() * sizeof(uint32_t));
+        m_file.write(reinterpret_cast<const char *>(elements.data()), elements.size() * sizeof(T));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ValidationOutputWriter::WriteString(const std::string &value)
+{
+    this->WriteValue(static_cast<uint32_t>(value.size()));
+    m_file.write(value.c_str(), value.size());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ValidationOutputWriter::WriteValue(const T &value)
+{
+    m_file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+} // namespace lar_content
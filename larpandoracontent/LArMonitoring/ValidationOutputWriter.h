@@ -0,0 +1,169 @@
+/**
+ *  @file   larpandoracontent/LArMonitoring/ValidationOutputWriter.h
+ *
+ *  @brief  Header file for the asynchronous, columnar validation output writer class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_VALIDATION_OUTPUT_WRITER_H
+#define LAR_VALIDATION_OUTPUT_WRITER_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ValidationOutputWriter class. Rows are snapshotted by the caller and queued for a background thread, which groups them into
+ *          baskets of a configurable number of rows and writes each basket to file column by column.
+ *
+ *          File layout (native byte order): the magic string "LARVALID", a uint32 format version and the length-prefixed tree name,
+ *          followed by a sequence of baskets. Each basket holds a uint32 row count, a uint32 column count and then, per column, the
+ *          length-prefixed column name, a uint8 column type and the column payload. Scalar payloads are one value per row; vector
+ *          payloads are one uint32 size per row followed by the concatenated vector elements. A variable not set for a row is written
+ *          as zero (or as an empty vector), so it cannot be distinguished from a value explicitly set to zero.
+ */
+class ValidationOutputWriter
+{
+public:
+    /**
+     *  @brief  Constructor, opening the output file and starting the writer thread
+     *
+     *  @param  fileName the output file name
+     *  @param  treeName the output tree name
+     *  @param  basketSize the number of rows to collect before writing a basket
+     */
+    ValidationOutputWriter(const std::string &fileName, const std::string &treeName, const unsigned int basketSize);
+
+    /**
+     *  @brief  Destructor, writing any queued rows and joining the writer thread
+     */
+    ~ValidationOutputWriter();
+
+    /**
+     *  @brief  Set a variable in the current row
+     *
+     *  @param  variableName the variable name
+     *  @param  value the variable value
+     */
+    void SetVariable(const std::string &variableName, const int value);
+
+    /**
+     *  @brief  Set a variable in the current row
+     *
+     *  @param  variableName the variable name
+     *  @param  value the variable value
+     */
+    void SetVariable(const std::string &variableName, const float value);
+
+    /**
+     *  @brief  Set a variable in the current row, copying the provided vector
+     *
+     *  @param  variableName the variable name
+     *  @param  value the variable value
+     */
+    void SetVariable(const std::string &variableName, const pandora::IntVector &value);
+
+    /**
+     *  @brief  Set a variable in the current row, copying the provided vector
+     *
+     *  @param  variableName the variable name
+     *  @param  value the variable value
+     */
+    void SetVariable(const std::string &variableName, const pandora::FloatVector &value);
+
+    /**
+     *  @brief  Queue the current row for writing and start a new row. Never waits on file output.
+     */
+    void Fill();
+
+private:
+    /**
+     *  @brief  Row class, a snapshot of the variables set between calls to Fill
+     */
+    class Row
+    {
+    public:
+        std::map<std::string, int> m_intValues;                          ///< The int variables
+        std::map<std::string, float> m_floatValues;                      ///< The float variables
+        std::map<std::string, pandora::IntVector> m_intVectorValues;     ///< The int vector variables
+        std::map<std::string, pandora::FloatVector> m_floatVectorValues; ///< The float vector variables
+    };
+
+    typedef std::vector<Row> RowVector;
+    typedef std::set<std::string> StringSet;
+
+    /**
+     *  @brief  The writer thread loop: wait for a full basket (or shutdown) and write it
+     */
+    void Process();
+
+    /**
+     *  @brief  Write a basket of rows to file, column by column
+     *
+     *  @param  rowVector the rows in the basket
+     */
+    void WriteBasket(const RowVector &rowVector);
+
+    /**
+     *  @brief  Write the scalar columns of a given type for a basket of rows
+     *
+     *  @param  rowVector the rows in the basket
+     *  @param  columnNames the names of the columns to write
+     *  @param  columnType the column type code
+     *  @param  getValues function returning the relevant value map for a row
+     */
+    template <typename T, typename GETTER>
+    void WriteScalarColumns(const RowVector &rowVector, const StringSet &columnNames, const uint8_t columnType, const GETTER &getValues);
+
+    /**
+     *  @brief  Write the vector columns of a given type for a basket of rows
+     *
+     *  @param  rowVector the rows in the basket
+     *  @param  columnNames the names of the columns to write
+     *  @param  columnType the column type code
+     *  @param  getValues function returning the relevant value map for a row
+     */
+    template <typename T, typename GETTER>
+    void WriteVectorColumns(const RowVector &rowVector, const StringSet &columnNames, const uint8_t columnType, const GETTER &getValues);
+
+    /**
+     *  @brief  Write a length-prefixed string
+     *
+     *  @param  value the string
+     */
+    void WriteString(const std::string &value);
+
+    /**
+     *  @brief  Write a plain value
+     *
+     *  @param  value the value
+     */
+    template <typename T>
+    void WriteValue(const T &value);
+
+    std::ofstream m_file;      ///< The output file, accessed only by the writer thread after construction
+    std::string m_fileName;    ///< The output file name
+    unsigned int m_basketSize; ///< The number of rows to collect before writing a basket
+    Row m_currentRow;          ///< The row being filled, accessed only by the calling thread
+
+    std::mutex m_mutex;                  ///< The mutex protecting the pending rows and the stop flag
+    std::condition_variable m_condition; ///< The condition variable used to wake the writer thread
+    RowVector m_pendingRows;             ///< The rows queued for writing
+    bool m_isStopping;                   ///< Whether the writer thread has been asked to finish
+    std::thread m_thread;                ///< The writer thread
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_VALIDATION_OUTPUT_WRITER_H
@@ -22,6 +22,7 @@ DiscreteProbabilityVector::DiscreteProbabilityVector(const InputData<TX, TY> &in
     m_discreteProbabilityData(this->InitialiseDiscreteProbabilityData(inputData))
 {
     this->VerifyCompleteData();
+    this->FillLookupArrays();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -32,6 +33,7 @@ DiscreteProbabilityVector::DiscreteProbabilityVector(const DiscreteProbabilityVe
     m_discreteProbabilityData(this->RandomiseDiscreteProbabilityData(discreteProbabilityVector, randomNumberGenerator))
 {
     this->VerifyCompleteData();
+    this->FillLookupArrays();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -42,38 +44,59 @@ DiscreteProbabilityVector::DiscreteProbabilityVector(const DiscreteProbabilityVe
     m_discreteProbabilityData(this->ResampleDiscreteProbabilityData(discreteProbabilityVector, resamplingPoints))
 {
     this->VerifyCompleteData();
+    this->FillLookupArrays();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float DiscreteProbabilityVector::EvaluateCumulativeProbability(const float x) const
 {
-    if (x - m_discreteProbabilityData.back().GetX() > std::numeric_limits<float>::epsilon())
+    if (x - m_xValues.back() > std::numeric_limits<float>::epsilon())
         return 1.f;
 
-    if (x - m_discreteProbabilityData.front().GetX() < std::numeric_limits<float>::epsilon())
+    if (x - m_xValues.front() < std::numeric_limits<float>::epsilon())
         return 0.f;
 
-    for (unsigned int iDatum = 1; iDatum < m_discreteProbabilityData.size(); ++iDatum)
-    {
-        if (x - m_discreteProbabilityData.at(iDatum).GetX() > std::numeric_limits<float>::epsilon())
-            continue;
+    const pandora::FloatVector::const_iterator iter(std::partition_point(m_xValues.begin() + 1, m_xValues.end(),
+        [x](const float xDatum) { return (x - xDatum > std::numeric_limits<float>::epsilon()); }));
+
+    return this->InterpolateCumulativeProbability(x, static_cast<unsigned int>(iter - m_xValues.begin()));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-        const float xLow(m_discreteProbabilityData.at(iDatum - 1).GetX());
-        const float yLow(m_discreteProbabilityData.at(iDatum - 1).GetCumulativeDatum());
-        const float xHigh(m_discreteProbabilityData.at(iDatum).GetX());
-        const float yHigh(m_discreteProbabilityData.at(iDatum).GetCumulativeDatum());
+void DiscreteProbabilityVector::EvaluateCumulativeProbabilities(const pandora::FloatVector &xValues, pandora::FloatVector &cumulativeProbabilities) const
+{
+    cumulativeProbabilities.clear();
+    cumulativeProbabilities.reserve(xValues.size());
+
+    unsigned int iDatum(1);
+
+    for (unsigned int iValue = 0; iValue < xValues.size(); ++iValue)
+    {
+        const float x(xValues.at(iValue));
 
-        if (std::fabs(xHigh - xLow) < std::numeric_limits<float>::epsilon())
+        if ((iValue > 0) && (x < xValues.at(iValue - 1)))
             throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
 
-        const float m((yHigh - yLow) / (xHigh - xLow));
-        const float c(yLow - m * xLow);
+        if (x - m_xValues.back() > std::numeric_limits<float>::epsilon())
+        {
+            cumulativeProbabilities.emplace_back(1.f);
+            continue;
+        }
 
-        return m * x + c;
-    }
+        if (x - m_xValues.front() < std::numeric_limits<float>::epsilon())
+        {
+            cumulativeProbabilities.emplace_back(0.f);
+            continue;
+        }
+
+        // ATTN The x values are in order, so the search can continue from the element found for the previous x value
+        while ((iDatum < m_xValues.size()) && (x - m_xValues[iDatum] > std::numeric_limits<float>::epsilon()))
+            ++iDatum;
 
-    throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+        cumulativeProbabilities.emplace_back(this->InterpolateCumulativeProbability(x, iDatum));
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -122,35 +145,36 @@ DiscreteProbabilityVector::DiscreteProbabilityData DiscreteProbabilityVector::Re
     if (2 > resamplingPoints.size())
         throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
 
-    DiscreteProbabilityData resampledProbabilityData;
+    pandora::FloatVector deltaXs;
 
-    float prevCumulativeData(0.f);
-    for (unsigned int iSample = 0; iSample < resamplingPoints.size() - 1; ++iSample)
+    for (unsigned int iSample = 0; iSample < resamplingPoints.size(); ++iSample)
     {
         const float xResampled(resamplingPoints.at(iSample));
-        const float deltaX(resamplingPoints.at(iSample + 1) - xResampled);
+        const float deltaX(((iSample + 1 < resamplingPoints.size()) ? resamplingPoints.at(iSample + 1) : m_xUpperBound) - xResampled);
 
         if (deltaX < std::numeric_limits<float>::epsilon())
             throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
 
-        const float cumulativeDatumResampled(discreteProbabilityVector.EvaluateCumulativeProbability(xResampled));
+        deltaXs.emplace_back(deltaX);
+    }
+
+    pandora::FloatVector cumulativeData;
+    discreteProbabilityVector.EvaluateCumulativeProbabilities(resamplingPoints, cumulativeData);
+
+    DiscreteProbabilityData resampledProbabilityData;
+
+    float prevCumulativeData(0.f);
+    for (unsigned int iSample = 0; iSample < resamplingPoints.size(); ++iSample)
+    {
+        const float xResampled(resamplingPoints.at(iSample));
+        const float deltaX(deltaXs.at(iSample));
+        const float cumulativeDatumResampled(cumulativeData.at(iSample));
         const float densityDatumResampled((cumulativeDatumResampled - prevCumulativeData) / (m_useWidths ? deltaX : 1.f));
         resampledProbabilityData.emplace_back(
             DiscreteProbabilityVector::DiscreteProbabilityDatum(xResampled, densityDatumResampled, cumulativeDatumResampled, deltaX));
         prevCumulativeData = cumulativeDatumResampled;
     }
 
-    const float xResampled(resamplingPoints.back());
-    const float deltaX(m_xUpperBound - xResampled);
-
-    if (deltaX < std::numeric_limits<float>::epsilon())
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
-
-    const float cumulativeDatumResampled(discreteProbabilityVector.EvaluateCumulativeProbability(xResampled));
-    const float densityDatumResampled((cumulativeDatumResampled - prevCumulativeData) / (m_useWidths ? deltaX : 1.f));
-    resampledProbabilityData.emplace_back(
-        DiscreteProbabilityVector::DiscreteProbabilityDatum(xResampled, densityDatumResampled, cumulativeDatumResampled, deltaX));
-
     return resampledProbabilityData;
 }
 
@@ -217,6 +241,43 @@ float DiscreteProbabilityVector::CalculateNormalisation(const InputData<TX, TY>
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float DiscreteProbabilityVector::InterpolateCumulativeProbability(const float x, const unsigned int iDatum) const
+{
+    if ((0 == iDatum) || (m_xValues.size() <= iDatum))
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    const float xLow(m_xValues[iDatum - 1]);
+    const float yLow(m_cumulativeValues[iDatum - 1]);
+    const float xHigh(m_xValues[iDatum]);
+    const float yHigh(m_cumulativeValues[iDatum]);
+
+    if (std::fabs(xHigh - xLow) < std::numeric_limits<float>::epsilon())
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    const float m((yHigh - yLow) / (xHigh - xLow));
+    const float c(yLow - m * xLow);
+
+    return m * x + c;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DiscreteProbabilityVector::FillLookupArrays()
+{
+    m_xValues.clear();
+    m_cumulativeValues.clear();
+    m_xValues.reserve(m_discreteProbabilityData.size());
+    m_cumulativeValues.reserve(m_discreteProbabilityData.size());
+
+    for (const DiscreteProbabilityDatum &datum : m_discreteProbabilityData)
+    {
+        m_xValues.emplace_back(datum.GetX());
+        m_cumulativeValues.emplace_back(datum.GetCumulativeDatum());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template DiscreteProbabilityVector::DiscreteProbabilityVector(const InputData<int, float> &, int const, bool const);
 template DiscreteProbabilityVector::DiscreteProbabilityVector(const InputData<float, int> &, float const, bool const);
 template DiscreteProbabilityVector::DiscreteProbabilityVector(const AllFloatInputData &, float const, bool const);
@@ -70,6 +70,15 @@ public:
      */
     float EvaluateCumulativeProbability(const float x) const;
 
+    /**
+     *  @brief  Evaluate the cumulative probability at each of an array of x values, merging the x values with the probability data
+     *          in a single pass rather than searching the probability data for each x value
+     *
+     *  @param  xValues the x values, which must be in non-decreasing order
+     *  @param  cumulativeProbabilities to receive the cumulative probability at each x value
+     */
+    void EvaluateCumulativeProbabilities(const pandora::FloatVector &xValues, pandora::FloatVector &cumulativeProbabilities) const;
+
     /**
      *  @brief  Get the size of the probability vector
      *
@@ -241,6 +250,21 @@ private:
     template <typename TX, typename TY>
     float CalculateNormalisation(const InputData<TX, TY> &inputData) const;
 
+    /**
+     *  @brief  Interpolate the cumulative probability at an x value between two adjacent elements of the probability vector
+     *
+     *  @param  x the x value
+     *  @param  iDatum the index of the first element whose x value is not below the input x value, must be at least one
+     *
+     *  @return the cumulative probability
+     */
+    float InterpolateCumulativeProbability(const float x, const unsigned int iDatum) const;
+
+    /**
+     *  @brief  Fill the contiguous x and cumulative probability arrays used to evaluate the cumulative probability
+     */
+    void FillLookupArrays();
+
     /**
      *  @brief  Verify the integrity of the complete probability vector
      */
@@ -256,6 +280,8 @@ private:
     float m_xUpperBound;                               ///< the upper bound of the probability vector
     bool m_useWidths;                                  ///< controls whether bin widths are used in calculations
     DiscreteProbabilityData m_discreteProbabilityData; ///< the probability data
+    pandora::FloatVector m_xValues;                    ///< the x values of the probability data, for fast lookup
+    pandora::FloatVector m_cumulativeValues;           ///< the cumulative probabilities of the probability data, for fast lookup
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
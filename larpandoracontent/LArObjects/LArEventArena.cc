@@ -0,0 +1,131 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArEventArena.cc
+ *
+ *  @brief  Implementation of the lar event arena class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArObjects/LArEventArena.h"
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+
+namespace lar_content
+{
+
+const std::size_t EventArena::m_initialBufferSize = 1 << 16;
+const std::size_t EventArena::m_maxBufferSize = 1 << 24;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventArena::CheckLiveAllocations(const std::string &clientName)
+{
+    const Resource &resource(EventArena::GetThreadResource());
+
+    if (0 != resource.m_nLiveAllocations)
+    {
+        std::cout << "EventArena: " << resource.m_nLiveAllocations << " allocations still live at " << clientName
+                  << " reset, the retained buffer cannot be rewound until they are returned" << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventArena::Resource &EventArena::GetThreadResource()
+{
+    thread_local Resource resource;
+    return resource;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventArena::Resource::Resource() :
+    m_nLiveAllocations(0),
+    m_nAllocations(0),
+    m_nOverflowAllocations(0),
+    m_nBufferAllocations(0),
+    m_cycleSize(0),
+    m_bufferSize(EventArena::m_initialBufferSize),
+    m_bufferOffset(0),
+    m_buffer(new std::byte[m_bufferSize])
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventArena::Resource::Rewind()
+{
+    if ((m_cycleSize > m_bufferSize) && (m_bufferSize < EventArena::m_maxBufferSize))
+    {
+        // ATTN Grow the retained buffer to fit the largest cycle, so that later cycles of the same size need no heap allocations
+        m_bufferSize = std::min(std::max(m_cycleSize, 2 * m_bufferSize), EventArena::m_maxBufferSize);
+        m_buffer.reset(new std::byte[m_bufferSize]);
+        ++m_nBufferAllocations;
+    }
+
+    m_bufferOffset = 0;
+    m_cycleSize = 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool EventArena::Resource::IsInBuffer(const void *const p) const
+{
+    const std::byte *const pByte(static_cast<const std::byte *>(p));
+    const std::less<const std::byte *> isLess;
+
+    return (!isLess(pByte, m_buffer.get()) && isLess(pByte, m_buffer.get() + m_bufferSize));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void *EventArena::Resource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    ++m_nAllocations;
+    m_cycleSize += bytes + alignment;
+
+    void *p(m_buffer.get() + m_bufferOffset);
+    std::size_t space(m_bufferSize - m_bufferOffset);
+
+    // ATTN Reserve at least one byte, so that every address served from the buffer lies inside it
+    if (std::align(alignment, std::max(bytes, std::size_t(1)), p, space))
+    {
+        m_bufferOffset = m_bufferSize - space + std::max(bytes, std::size_t(1));
+        ++m_nLiveAllocations;
+        return p;
+    }
+
+    ++m_nOverflowAllocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventArena::Resource::do_deallocate(void *p, std::size_t bytes, std::size_t alignment)
+{
+    if (!this->IsInBuffer(p))
+    {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+
+        // ATTN A cycle served entirely by the heap must still be able to grow the retained buffer
+        if (0 == m_nLiveAllocations)
+            this->Rewind();
+
+        return;
+    }
+
+    if ((m_nLiveAllocations > 0) && (0 == --m_nLiveAllocations))
+        this->Rewind();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool EventArena::Resource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+    return (this == &other);
+}
+
+} // namespace lar_content
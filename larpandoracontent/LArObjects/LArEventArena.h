@@ -0,0 +1,166 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArEventArena.h
+ *
+ *  @brief  Header file for the lar event arena class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_EVENT_ARENA_H
+#define LAR_EVENT_ARENA_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace lar_content
+{
+
+template <typename T>
+using ArenaVector = std::pmr::vector<T>;
+
+template <typename T>
+using ArenaUnorderedSet = std::pmr::unordered_set<T>;
+
+template <typename TKey, typename TValue>
+using ArenaUnorderedMap = std::pmr::unordered_map<TKey, TValue>;
+
+typedef ArenaVector<const pandora::Cluster *> ArenaClusterVector;
+typedef ArenaUnorderedSet<const pandora::Cluster *> ArenaClusterSet;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  EventArena class, providing a thread-local memory resource for transient per-event containers. Allocations are bump-allocated
+ *          from a retained buffer and individual deallocations are no-ops; the buffer is rewound wholesale once every allocation from it
+ *          has been returned, and grown at that point if the last cycle overflowed it. Allocations that do not fit in the buffer are served
+ *          by the heap and freed individually, so a container that outlives its event delays the rewind but cannot make the arena grow.
+ *          Containers using the arena must be created, modified and destroyed on a single thread.
+ */
+class EventArena
+{
+public:
+    /**
+     *  @brief  Get the arena memory resource for the current thread
+     *
+     *  @return the address of the memory resource
+     */
+    static std::pmr::memory_resource *GetResource();
+
+    /**
+     *  @brief  Check the arena for the current thread at event reset, reporting any allocations from the retained buffer that are still
+     *          live, as these prevent the buffer from being rewound. The arena does not rely on this check to recycle its memory.
+     *
+     *  @param  clientName the name of the client performing the check, used in the report
+     */
+    static void CheckLiveAllocations(const std::string &clientName);
+
+    /**
+     *  @brief  Get the number of allocations served by the arena for the current thread
+     *
+     *  @return the number of allocations
+     */
+    static std::size_t GetNAllocations();
+
+    /**
+     *  @brief  Get the number of allocations served by the heap for the current thread, as they did not fit in the retained buffer
+     *
+     *  @return the number of overflow allocations
+     */
+    static std::size_t GetNOverflowAllocations();
+
+    /**
+     *  @brief  Get the number of times the retained buffer for the current thread has been grown
+     *
+     *  @return the number of buffer allocations
+     */
+    static std::size_t GetNBufferAllocations();
+
+private:
+    /**
+     *  @brief  Resource class
+     */
+    class Resource : public std::pmr::memory_resource
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        Resource();
+
+        std::size_t m_nLiveAllocations;     ///< The number of allocations from the retained buffer not yet returned
+        std::size_t m_nAllocations;         ///< The number of allocations served
+        std::size_t m_nOverflowAllocations; ///< The number of allocations served by the heap
+        std::size_t m_nBufferAllocations;   ///< The number of times the retained buffer has been grown
+
+    private:
+        /**
+         *  @brief  Rewind the retained buffer, growing it if the last cycle overflowed it
+         */
+        void Rewind();
+
+        /**
+         *  @brief  Whether an address lies in the retained buffer
+         *
+         *  @param  p the address
+         *
+         *  @return boolean
+         */
+        bool IsInBuffer(const void *const p) const;
+
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+        std::size_t m_cycleSize;               ///< The upper bound on the bytes requested since the last rewind
+        std::size_t m_bufferSize;              ///< The size of the retained buffer
+        std::size_t m_bufferOffset;            ///< The offset of the first unused byte in the retained buffer
+        std::unique_ptr<std::byte[]> m_buffer; ///< The retained buffer
+    };
+
+    /**
+     *  @brief  Get the resource for the current thread
+     *
+     *  @return the resource
+     */
+    static Resource &GetThreadResource();
+
+    static const std::size_t m_initialBufferSize; ///< The initial size of the retained buffer
+    static const std::size_t m_maxBufferSize;     ///< The maximum size to which the retained buffer may be grown
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline std::pmr::memory_resource *EventArena::GetResource()
+{
+    return &EventArena::GetThreadResource();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline std::size_t EventArena::GetNAllocations()
+{
+    return EventArena::GetThreadResource().m_nAllocations;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline std::size_t EventArena::GetNOverflowAllocations()
+{
+    return EventArena::GetThreadResource().m_nOverflowAllocations;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline std::size_t EventArena::GetNBufferAllocations()
+{
+    return EventArena::GetThreadResource().m_nBufferAllocations;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_EVENT_ARENA_H
@@ -20,37 +20,50 @@
 #include "larpandoracontent/LArObjects/LArTrackTwoViewOverlapResult.h"
 
 #include <algorithm>
+#include <limits>
 
 using namespace pandora;
 
 namespace lar_content
 {
 
+template <typename T>
+const unsigned int OverlapMatrix<T>::m_nKeyBits = 32;
+
+template <typename T>
+const std::uint64_t OverlapMatrix<T>::m_invalidKey = std::numeric_limits<std::uint64_t>::max();
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void OverlapMatrix<T>::GetUnambiguousElements(const bool ignoreUnavailable, ElementList &elementList) const
 {
-    for (typename TheMatrix::const_iterator iter1 = this->begin(), iter1End = this->end(); iter1 != iter1End; ++iter1)
+    ClusterVector keyClusters;
+    this->GetKeyClusters(keyClusters);
+
+    for (const Cluster *const pKeyCluster : keyClusters)
     {
         ElementList tempElementList;
         ClusterList clusterList1, clusterList2;
-        this->GetConnectedElements(iter1->first, ignoreUnavailable, tempElementList, clusterList1, clusterList2);
+        this->GetConnectedElements(pKeyCluster, ignoreUnavailable, tempElementList, clusterList1, clusterList2);
 
         const Cluster *pCluster1(nullptr), *pCluster2(nullptr);
         if (!this->DefaultAmbiguityFunction(clusterList1, clusterList2, pCluster1, pCluster2))
             continue;
 
         // ATTN With HIT_CUSTOM definitions, it is possible to navigate from different view 1 clusters to same combination
-        if (iter1->first != pCluster1)
+        if (pKeyCluster != pCluster1)
             continue;
 
         if (!pCluster1 || !pCluster2)
             continue;
 
-        typename OverlapList::const_iterator iter2 = iter1->second.find(pCluster2);
-        if (iter1->second.end() == iter2)
+        const OverlapResult *const pOverlapResult(this->FindOverlapResult(pCluster1, pCluster2));
+
+        if (!pOverlapResult)
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        Element element(pCluster1, pCluster2, iter2->second);
+        Element element(pCluster1, pCluster2, *pOverlapResult);
         elementList.push_back(element);
     }
 
@@ -87,27 +100,108 @@ void OverlapMatrix<T>::GetConnectedElements(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename T>
-void OverlapMatrix<T>::GetSortedKeyClusters(ClusterVector &sortedKeyClusters) const
+void OverlapMatrix<T>::GetAllElements(const bool ignoreUnavailable, ElementList &elementList) const
 {
-    for (typename TheMatrix::const_iterator iter1 = this->begin(), iter1End = this->end(); iter1 != iter1End; ++iter1)
-        sortedKeyClusters.push_back(iter1->first);
+    if (!m_useFlatStorage)
+    {
+        for (const typename TheMatrix::value_type &listEntry : m_overlapMatrix)
+        {
+            for (const typename OverlapList::value_type &resultEntry : listEntry.second)
+            {
+                if (ignoreUnavailable && (!listEntry.first->IsAvailable() || !resultEntry.first->IsAvailable()))
+                    continue;
+
+                elementList.push_back(Element(listEntry.first, resultEntry.first, resultEntry.second));
+            }
+        }
+
+        return;
+    }
+
+    this->SortEntries();
+    const std::uint64_t indexMask((static_cast<std::uint64_t>(1) << m_nKeyBits) - 1);
+
+    for (const Entry &entry : m_entryList)
+    {
+        const Cluster *const pCluster1(m_clusterVector1[entry.first >> m_nKeyBits]);
+        const Cluster *const pCluster2(m_clusterVector2[entry.first & indexMask]);
+
+        if (ignoreUnavailable && (!pCluster1->IsAvailable() || !pCluster2->IsAvailable()))
+            continue;
+
+        elementList.push_back(Element(pCluster1, pCluster2, m_overlapResults[entry.second]));
+    }
+}
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapMatrix<T>::GetSortedKeyClusters(ClusterVector &sortedKeyClusters) const
+{
+    this->GetKeyClusters(sortedKeyClusters);
     std::sort(sortedKeyClusters.begin(), sortedKeyClusters.end(), LArClusterHelper::SortByNHits);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void OverlapMatrix<T>::SetUseFlatStorage(const bool useFlatStorage)
+{
+    if (!m_overlapMatrix.empty() || !m_resultIndexMap.empty() || !m_clusterNavigationMap12.empty())
+        throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+
+    this->Clear();
+    m_useFlatStorage = useFlatStorage;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void OverlapMatrix<T>::SetOverlapResult(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, const OverlapResult &overlapResult)
 {
-    OverlapList &overlapList = m_overlapMatrix[pCluster1];
-    typename OverlapList::const_iterator iter = overlapList.find(pCluster2);
+    if (!m_useFlatStorage)
+    {
+        OverlapList &overlapList = m_overlapMatrix[pCluster1];
+        typename OverlapList::const_iterator iter = overlapList.find(pCluster2);
+
+        if (overlapList.end() != iter)
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_ALREADY_PRESENT);
+
+        if (!overlapList.insert(typename OverlapList::value_type(pCluster2, overlapResult)).second)
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+    }
+    else
+    {
+        const std::uint64_t key(OverlapMatrix<T>::GetKey(OverlapMatrix<T>::GetOrAddClusterIndex(pCluster1, m_clusterIndexMap1, m_clusterVector1),
+            OverlapMatrix<T>::GetOrAddClusterIndex(pCluster2, m_clusterIndexMap2, m_clusterVector2)));
+
+        if (m_resultIndexMap.count(key))
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_ALREADY_PRESENT);
+
+        unsigned int resultIndex(m_overlapResults.size());
+
+        if (!m_freeResultIndices.empty())
+        {
+            resultIndex = m_freeResultIndices.back();
+            m_overlapResults[resultIndex] = overlapResult;
+            m_resultKeys[resultIndex] = key;
+            m_freeResultIndices.pop_back();
+        }
+        else
+        {
+            m_overlapResults.push_back(overlapResult);
+            m_resultKeys.push_back(key);
+        }
 
-    if (overlapList.end() != iter)
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_ALREADY_PRESENT);
+        if (!m_resultIndexMap.insert(typename ResultIndexMap::value_type(key, resultIndex)).second)
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
 
-    if (!overlapList.insert(typename OverlapList::value_type(pCluster2, overlapResult)).second)
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+        if (!m_entryList.empty() && (m_entryList.back().first > key))
+            m_isEntryListSorted = false;
+
+        m_entryList.emplace_back(key, resultIndex);
+        m_isMatrixViewValid = false;
+    }
 
     ClusterList &navigation12(m_clusterNavigationMap12[pCluster1]);
     ClusterList &navigation21(m_clusterNavigationMap21[pCluster2]);
@@ -123,17 +217,30 @@ void OverlapMatrix<T>::SetOverlapResult(const pandora::Cluster *const pCluster1,
 template <typename T>
 void OverlapMatrix<T>::ReplaceOverlapResult(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, const OverlapResult &overlapResult)
 {
-    typename TheMatrix::iterator iter1 = m_overlapMatrix.find(pCluster1);
+    if (!m_useFlatStorage)
+    {
+        typename TheMatrix::iterator iter1 = m_overlapMatrix.find(pCluster1);
 
-    if (m_overlapMatrix.end() == iter1)
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+        if (m_overlapMatrix.end() == iter1)
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+        typename OverlapList::iterator iter2 = iter1->second.find(pCluster2);
 
-    typename OverlapList::iterator iter2 = iter1->second.find(pCluster2);
+        if (iter1->second.end() == iter2)
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
 
-    if (iter1->second.end() == iter2)
+        iter2->second = overlapResult;
+        return;
+    }
+
+    std::uint64_t key(0);
+    typename ResultIndexMap::const_iterator iter(this->GetKey(pCluster1, pCluster2, key) ? m_resultIndexMap.find(key) : m_resultIndexMap.end());
+
+    if (m_resultIndexMap.end() == iter)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
 
-    iter2->second = overlapResult;
+    m_overlapResults[iter->second] = overlapResult;
+    m_isMatrixViewValid = false;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -145,10 +252,17 @@ void OverlapMatrix<T>::RemoveCluster(const pandora::Cluster *const pCluster)
 
     if (m_clusterNavigationMap12.erase(pCluster) > 0)
     {
-        typename TheMatrix::iterator iter = m_overlapMatrix.find(pCluster);
+        if (!m_useFlatStorage)
+        {
+            typename TheMatrix::iterator iter = m_overlapMatrix.find(pCluster);
 
-        if (m_overlapMatrix.end() != iter)
-            m_overlapMatrix.erase(iter);
+            if (m_overlapMatrix.end() != iter)
+                m_overlapMatrix.erase(iter);
+        }
+        else
+        {
+            this->RemoveOverlapResults(pCluster, m_clusterIndexMap1, m_nKeyBits);
+        }
 
         for (ClusterNavigationMap::iterator navIter = m_clusterNavigationMap21.begin(); navIter != m_clusterNavigationMap21.end();)
         {
@@ -165,12 +279,14 @@ void OverlapMatrix<T>::RemoveCluster(const pandora::Cluster *const pCluster)
 
     if (m_clusterNavigationMap21.erase(pCluster) > 0)
     {
-        for (typename TheMatrix::iterator iter1 = m_overlapMatrix.begin(), iter1End = m_overlapMatrix.end(); iter1 != iter1End; ++iter1)
+        if (!m_useFlatStorage)
         {
-            typename OverlapList::iterator iter = iter1->second.find(pCluster);
-
-            if (iter1->second.end() != iter)
-                iter1->second.erase(iter);
+            for (typename TheMatrix::value_type &listEntry : m_overlapMatrix)
+                listEntry.second.erase(pCluster);
+        }
+        else
+        {
+            this->RemoveOverlapResults(pCluster, m_clusterIndexMap2, 0);
         }
 
         for (ClusterNavigationMap::iterator navIter = m_clusterNavigationMap12.begin(); navIter != m_clusterNavigationMap12.end();)
@@ -186,6 +302,8 @@ void OverlapMatrix<T>::RemoveCluster(const pandora::Cluster *const pCluster)
         }
     }
 
+    // ATTN The navigation maps define the keys of the nested map view of flat storage, so it is out of date even if no results were removed
+    m_isMatrixViewValid = false;
     additionalRemovals.sort(LArClusterHelper::SortByNHits);
 
     for (ClusterList::const_iterator iter = additionalRemovals.begin(), iterEnd = additionalRemovals.end(); iter != iterEnd; ++iter)
@@ -198,31 +316,81 @@ template <typename T>
 void OverlapMatrix<T>::GetConnectedElements(const Cluster *const pCluster, const bool ignoreUnavailable, ElementList &elementList,
     ClusterList &clusterList1, ClusterList &clusterList2) const
 {
+    ClusterSet exploredClusters;
     ClusterList localClusterList1, localClusterList2;
-    this->ExploreConnections(pCluster, ignoreUnavailable, localClusterList1, localClusterList2);
+    this->ExploreConnections(pCluster, ignoreUnavailable, exploredClusters, localClusterList1, localClusterList2);
 
     // ATTN Now need to check that all clusters received are from fully available matrix elements
     elementList.clear();
     clusterList1.clear();
     clusterList2.clear();
 
-    for (typename TheMatrix::const_iterator iter1 = this->begin(), iter1End = this->end(); iter1 != iter1End; ++iter1)
+    ClusterSet connectedClusters;
+
+    if (!m_useFlatStorage)
     {
-        if (localClusterList1.end() == std::find(localClusterList1.begin(), localClusterList1.end(), iter1->first))
+        const ClusterSet localClusters1(localClusterList1.begin(), localClusterList1.end());
+
+        for (const typename TheMatrix::value_type &listEntry : m_overlapMatrix)
+        {
+            const Cluster *const pCluster1(listEntry.first);
+
+            if (!localClusters1.count(pCluster1))
+                continue;
+
+            for (const typename OverlapList::value_type &resultEntry : listEntry.second)
+            {
+                const Cluster *const pCluster2(resultEntry.first);
+
+                if (ignoreUnavailable && (!pCluster1->IsAvailable() || !pCluster2->IsAvailable()))
+                    continue;
+
+                Element element(pCluster1, pCluster2, resultEntry.second);
+                elementList.push_back(element);
+
+                if (connectedClusters.insert(pCluster1).second)
+                    clusterList1.push_back(pCluster1);
+                if (connectedClusters.insert(pCluster2).second)
+                    clusterList2.push_back(pCluster2);
+            }
+        }
+
+        std::sort(elementList.begin(), elementList.end());
+        return;
+    }
+
+    // ATTN Only visit the flat storage entries for the connected view 1 clusters, so that the cost scales with the size of the connected component
+    this->SortEntries();
+    const std::uint64_t indexMask((static_cast<std::uint64_t>(1) << m_nKeyBits) - 1);
+
+    for (const Cluster *const pCluster1 : localClusterList1)
+    {
+        ClusterIndexMap::const_iterator indexIter(m_clusterIndexMap1.find(pCluster1));
+
+        if (m_clusterIndexMap1.end() == indexIter)
             continue;
 
-        for (typename OverlapList::const_iterator iter2 = iter1->second.begin(), iter2End = iter1->second.end(); iter2 != iter2End; ++iter2)
+        // ATTN The coordinate list is sorted by key, with the view 1 index in the most significant bits
+        const Entry firstEntry(OverlapMatrix<T>::GetKey(indexIter->second, 0), 0);
+        typename EntryList::const_iterator iter(std::lower_bound(m_entryList.begin(), m_entryList.end(), firstEntry));
+
+        for (typename EntryList::const_iterator iterEnd = m_entryList.end(); iter != iterEnd; ++iter)
         {
-            if (ignoreUnavailable && (!iter1->first->IsAvailable() || !iter2->first->IsAvailable()))
+            if ((iter->first >> m_nKeyBits) != indexIter->second)
+                break;
+
+            const Cluster *const pCluster2(m_clusterVector2[iter->first & indexMask]);
+
+            if (ignoreUnavailable && (!pCluster1->IsAvailable() || !pCluster2->IsAvailable()))
                 continue;
 
-            Element element(iter1->first, iter2->first, iter2->second);
+            Element element(pCluster1, pCluster2, m_overlapResults[iter->second]);
             elementList.push_back(element);
 
-            if (clusterList1.end() == std::find(clusterList1.begin(), clusterList1.end(), iter1->first))
-                clusterList1.push_back(iter1->first);
-            if (clusterList2.end() == std::find(clusterList2.begin(), clusterList2.end(), iter2->first))
-                clusterList2.push_back(iter2->first);
+            if (connectedClusters.insert(pCluster1).second)
+                clusterList1.push_back(pCluster1);
+            if (connectedClusters.insert(pCluster2).second)
+                clusterList2.push_back(pCluster2);
         }
     }
 
@@ -232,8 +400,8 @@ void OverlapMatrix<T>::GetConnectedElements(const Cluster *const pCluster, const
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename T>
-void OverlapMatrix<T>::ExploreConnections(
-    const Cluster *const pCluster, const bool ignoreUnavailable, ClusterList &clusterList1, ClusterList &clusterList2) const
+void OverlapMatrix<T>::ExploreConnections(const Cluster *const pCluster, const bool ignoreUnavailable, ClusterSet &exploredClusters,
+    ClusterList &clusterList1, ClusterList &clusterList2) const
 {
     if (ignoreUnavailable && !pCluster->IsAvailable())
         return;
@@ -250,7 +418,7 @@ void OverlapMatrix<T>::ExploreConnections(
     ClusterList &clusterList(clusterFromView1 ? clusterList1 : clusterList2);
     const ClusterNavigationMap &navigationMap(clusterFromView1 ? m_clusterNavigationMap12 : m_clusterNavigationMap21);
 
-    if (clusterList.end() != std::find(clusterList.begin(), clusterList.end(), pCluster))
+    if (!exploredClusters.insert(pCluster).second)
         return;
 
     clusterList.push_back(pCluster);
@@ -260,7 +428,196 @@ void OverlapMatrix<T>::ExploreConnections(
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
     for (ClusterList::const_iterator cIter = iter->second.begin(), cIterEnd = iter->second.end(); cIter != cIterEnd; ++cIter)
-        this->ExploreConnections(*cIter, ignoreUnavailable, clusterList1, clusterList2);
+        this->ExploreConnections(*cIter, ignoreUnavailable, exploredClusters, clusterList1, clusterList2);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapMatrix<T>::GetKeyClusters(ClusterVector &keyClusters) const
+{
+    if (!m_useFlatStorage)
+    {
+        for (const typename TheMatrix::value_type &listEntry : m_overlapMatrix)
+            keyClusters.push_back(listEntry.first);
+
+        return;
+    }
+
+    // ATTN With flat storage, the key clusters are exactly those with 1->2 navigation entries
+    for (const ClusterNavigationMap::value_type &mapEntry : m_clusterNavigationMap12)
+        keyClusters.push_back(mapEntry.first);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+unsigned int OverlapMatrix<T>::GetOrAddClusterIndex(const Cluster *const pCluster, ClusterIndexMap &clusterIndexMap, ClusterVector &clusterVector)
+{
+    const std::pair<ClusterIndexMap::const_iterator, bool> insertion(
+        clusterIndexMap.insert(ClusterIndexMap::value_type(pCluster, clusterVector.size())));
+
+    if (insertion.second)
+    {
+        if (clusterVector.size() > std::numeric_limits<unsigned int>::max())
+        {
+            clusterIndexMap.erase(pCluster);
+            throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+        }
+
+        clusterVector.push_back(pCluster);
+    }
+
+    return insertion.first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+bool OverlapMatrix<T>::GetKey(const Cluster *const pCluster1, const Cluster *const pCluster2, std::uint64_t &key) const
+{
+    ClusterIndexMap::const_iterator iter1(m_clusterIndexMap1.find(pCluster1));
+    ClusterIndexMap::const_iterator iter2(m_clusterIndexMap2.find(pCluster2));
+
+    if ((m_clusterIndexMap1.end() == iter1) || (m_clusterIndexMap2.end() == iter2))
+        return false;
+
+    key = OverlapMatrix<T>::GetKey(iter1->second, iter2->second);
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+std::uint64_t OverlapMatrix<T>::GetKey(const unsigned int index1, const unsigned int index2)
+{
+    return ((static_cast<std::uint64_t>(index1) << m_nKeyBits) | static_cast<std::uint64_t>(index2));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+bool OverlapMatrix<T>::IsCurrentEntry(const Entry &entry) const
+{
+    return (m_resultKeys[entry.second] == entry.first);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+const typename OverlapMatrix<T>::OverlapResult *OverlapMatrix<T>::FindOverlapResult(
+    const Cluster *const pCluster1, const Cluster *const pCluster2) const
+{
+    if (m_useFlatStorage)
+    {
+        std::uint64_t key(0);
+        typename ResultIndexMap::const_iterator iter(this->GetKey(pCluster1, pCluster2, key) ? m_resultIndexMap.find(key) : m_resultIndexMap.end());
+
+        return ((m_resultIndexMap.end() == iter) ? nullptr : &m_overlapResults[iter->second]);
+    }
+
+    typename TheMatrix::const_iterator iter1 = m_overlapMatrix.find(pCluster1);
+
+    if (m_overlapMatrix.end() == iter1)
+        return nullptr;
+
+    typename OverlapList::const_iterator iter2 = iter1->second.find(pCluster2);
+
+    return ((iter1->second.end() == iter2) ? nullptr : &iter2->second);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapMatrix<T>::RemoveOverlapResults(const Cluster *const pCluster, const ClusterIndexMap &clusterIndexMap, const unsigned int keyShift)
+{
+    ClusterIndexMap::const_iterator indexIter(clusterIndexMap.find(pCluster));
+
+    if (clusterIndexMap.end() == indexIter)
+        return;
+
+    const std::uint64_t indexMask((static_cast<std::uint64_t>(1) << m_nKeyBits) - 1);
+
+    for (const Entry &entry : m_entryList)
+    {
+        if ((((entry.first >> keyShift) & indexMask) == indexIter->second) && this->IsCurrentEntry(entry))
+            this->RemoveOverlapResult(entry.second);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapMatrix<T>::RemoveOverlapResult(const unsigned int resultIndex)
+{
+    m_resultIndexMap.erase(m_resultKeys[resultIndex]);
+    m_resultKeys[resultIndex] = m_invalidKey;
+
+    // ATTN The coordinate list entry is now stale, and the result index is only reused once the entry has been dropped
+    ++m_nStaleEntries;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapMatrix<T>::SortEntries() const
+{
+    if (m_nStaleEntries > 0)
+    {
+        typename EntryList::iterator outputIter(m_entryList.begin());
+
+        for (const Entry &entry : m_entryList)
+        {
+            if (this->IsCurrentEntry(entry))
+            {
+                *outputIter++ = entry;
+            }
+            else
+            {
+                m_freeResultIndices.push_back(entry.second);
+            }
+        }
+
+        m_entryList.erase(outputIter, m_entryList.end());
+        m_nStaleEntries = 0;
+    }
+
+    if (!m_isEntryListSorted)
+    {
+        std::sort(m_entryList.begin(), m_entryList.end());
+        m_isEntryListSorted = true;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+const typename OverlapMatrix<T>::TheMatrix &OverlapMatrix<T>::GetMatrixView() const
+{
+    if (!m_useFlatStorage)
+        return m_overlapMatrix;
+
+    if (m_isMatrixViewValid)
+        return m_matrixView;
+
+    m_matrixView.clear();
+
+    // ATTN Each view 1 cluster with 1->2 navigation entries corresponds to a (possibly empty) overlap list, as for nested map storage
+    for (const ClusterNavigationMap::value_type &mapEntry : m_clusterNavigationMap12)
+        m_matrixView[mapEntry.first];
+
+    this->SortEntries();
+    const std::uint64_t indexMask((static_cast<std::uint64_t>(1) << m_nKeyBits) - 1);
+
+    for (const Entry &entry : m_entryList)
+    {
+        const Cluster *const pCluster1(m_clusterVector1[entry.first >> m_nKeyBits]);
+        const Cluster *const pCluster2(m_clusterVector2[entry.first & indexMask]);
+        m_matrixView[pCluster1].insert(typename OverlapList::value_type(pCluster2, m_overlapResults[entry.second]));
+    }
+
+    m_isMatrixViewValid = true;
+    return m_matrixView;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
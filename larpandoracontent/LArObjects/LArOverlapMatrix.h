@@ -10,6 +10,8 @@
 
 #include "Pandora/PandoraInternal.h"
 
+#include <cstdint>
+#include <deque>
 #include <unordered_map>
 #include <vector>
 
@@ -17,7 +19,9 @@ namespace lar_content
 {
 
 /**
- *  @brief  OverlapMatrix class
+ *  @brief  OverlapMatrix class. Overlap results are held in nested maps unless flat storage is selected via SetUseFlatStorage. With flat
+ *          storage, clusters are assigned dense indices per view, results are kept in block-contiguous storage addressed via packed (1, 2)
+ *          index keys, and a lazily sorted coordinate list provides contiguous iteration over the results for each view 1 cluster.
  */
 template <typename T>
 class OverlapMatrix
@@ -76,6 +80,11 @@ public:
 
     typedef std::vector<Element> ElementList;
 
+    /**
+     *  @brief  Default constructor
+     */
+    OverlapMatrix();
+
     /**
      *  @brief  Get unambiguous elements
      *
@@ -128,6 +137,15 @@ public:
     void GetConnectedElements(const pandora::Cluster *const pCluster, const bool ignoreUnavailable, ElementList &elementList,
         unsigned int &n1, unsigned int &n2) const;
 
+    /**
+     *  @brief  Get a list of all elements, grouped by view 1 cluster. With flat storage, the elements are in coordinate list order and the
+     *          nested map view is not built.
+     *
+     *  @param  ignoreUnavailable whether to ignore unavailable clusters
+     *  @param  elementList to receive the element list
+     */
+    void GetAllElements(const bool ignoreUnavailable, ElementList &elementList) const;
+
     typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterList> ClusterNavigationMap;
     typedef std::unordered_map<const pandora::Cluster *, OverlapResult> OverlapList;
     typedef std::unordered_map<const pandora::Cluster *, OverlapList> TheMatrix;
@@ -135,7 +153,9 @@ public:
     typedef typename TheMatrix::const_iterator const_iterator;
 
     /**
-     *  @brief  Returns an iterator referring to the first element in the overlap matrix
+     *  @brief  Returns an iterator referring to the first element in the overlap matrix. With flat storage, this is an iterator into a
+     *          nested map view that is rebuilt by the first view access (begin, end or GetOverlapList) following any modification, and which
+     *          is then invalidated.
      */
     const_iterator begin() const;
 
@@ -166,7 +186,7 @@ public:
      *
      *  @param  pCluster1 address of cluster 1
      *
-     *  @return the cluster overlap list
+     *  @return the cluster overlap list, which with flat storage is invalidated as for begin
      */
     const OverlapList &GetOverlapList(const pandora::Cluster *const pCluster1) const;
 
@@ -184,6 +204,14 @@ public:
      */
     const ClusterNavigationMap &GetClusterNavigationMap21() const;
 
+    /**
+     *  @brief  Select whether overlap results are held in flat storage, rather than in nested maps. With flat storage, const member
+     *          functions may compact and sort the coordinate list and rebuild the nested map view, so must not be called concurrently.
+     *
+     *  @param  useFlatStorage whether to use flat storage
+     */
+    void SetUseFlatStorage(const bool useFlatStorage);
+
     /**
      *  @brief  Set overlap result
      *
@@ -230,15 +258,127 @@ private:
      *  @brief  Explore connections associated with a given cluster
      *
      *  @param  pCluster address of the cluster
+     *  @param  ignoreUnavailable whether to ignore unavailable clusters
+     *  @param  exploredClusters the clusters already explored
      *  @param  clusterList1 connected view 1 clusters
      *  @param  clusterList2 connected view 2 clusters
      */
-    void ExploreConnections(const pandora::Cluster *const pCluster, const bool ignoreUnavailable, pandora::ClusterList &clusterList1,
-        pandora::ClusterList &clusterList2) const;
+    void ExploreConnections(const pandora::Cluster *const pCluster, const bool ignoreUnavailable, pandora::ClusterSet &exploredClusters,
+        pandora::ClusterList &clusterList1, pandora::ClusterList &clusterList2) const;
+
+    /**
+     *  @brief  Get the key clusters, in nested map or navigation map order
+     *
+     *  @param  keyClusters to receive the key clusters
+     */
+    void GetKeyClusters(pandora::ClusterVector &keyClusters) const;
+
+    typedef std::unordered_map<const pandora::Cluster *, unsigned int> ClusterIndexMap;
+    typedef std::unordered_map<std::uint64_t, unsigned int> ResultIndexMap;
+    typedef std::pair<std::uint64_t, unsigned int> Entry;
+    typedef std::vector<Entry> EntryList;
+
+    /**
+     *  @brief  Get the dense index of a cluster in a given view, assigning a new index if required
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  clusterIndexMap the cluster index map for the view
+     *  @param  clusterVector the clusters in the view, ordered by index
+     *
+     *  @return the cluster index
+     */
+    static unsigned int GetOrAddClusterIndex(
+        const pandora::Cluster *const pCluster, ClusterIndexMap &clusterIndexMap, pandora::ClusterVector &clusterVector);
+
+    /**
+     *  @brief  Get the packed key for a specified pair of clusters
+     *
+     *  @param  pCluster1 address of cluster 1
+     *  @param  pCluster2 address of cluster 2
+     *  @param  key to receive the packed key
+     *
+     *  @return whether both clusters have been assigned indices
+     */
+    bool GetKey(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, std::uint64_t &key) const;
+
+    /**
+     *  @brief  Get the packed key for a specified pair of cluster indices
+     *
+     *  @param  index1 the view 1 cluster index
+     *  @param  index2 the view 2 cluster index
+     *
+     *  @return the packed key
+     */
+    static std::uint64_t GetKey(const unsigned int index1, const unsigned int index2);
+
+    /**
+     *  @brief  Whether a coordinate list entry refers to a current overlap result
+     *
+     *  @param  entry the coordinate list entry
+     *
+     *  @return boolean
+     */
+    bool IsCurrentEntry(const Entry &entry) const;
+
+    /**
+     *  @brief  Find the overlap result for a specified pair of clusters
+     *
+     *  @param  pCluster1 address of cluster 1
+     *  @param  pCluster2 address of cluster 2
+     *
+     *  @return the address of the overlap result, or nullptr if there is no such result
+     */
+    const OverlapResult *FindOverlapResult(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2) const;
+
+    /**
+     *  @brief  Remove the overlap results for which a specified view index matches that of the specified cluster
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  clusterIndexMap the cluster index map for the view
+     *  @param  keyShift the offset of the view index in the packed key
+     */
+    void RemoveOverlapResults(const pandora::Cluster *const pCluster, const ClusterIndexMap &clusterIndexMap, const unsigned int keyShift);
+
+    /**
+     *  @brief  Remove the overlap result at a given result index
+     *
+     *  @param  resultIndex the result index
+     */
+    void RemoveOverlapResult(const unsigned int resultIndex);
 
-    TheMatrix m_overlapMatrix;                     ///< The overlap matrix
-    ClusterNavigationMap m_clusterNavigationMap12; ///< The cluster navigation map 1->2
-    ClusterNavigationMap m_clusterNavigationMap21; ///< The cluster navigation map 2->1
+    /**
+     *  @brief  Remove coordinate list entries for overlap results that have since been removed, releasing their result indices, and sort
+     *          the coordinate list by key
+     */
+    void SortEntries() const;
+
+    /**
+     *  @brief  Get the nested map view of the overlap matrix, building it from the flat storage if required
+     *
+     *  @return the overlap matrix
+     */
+    const TheMatrix &GetMatrixView() const;
+
+    static const unsigned int m_nKeyBits;    ///< The number of bits for each view index in a packed key
+    static const std::uint64_t m_invalidKey; ///< The key marking unused result storage
+
+    bool m_useFlatStorage;                                 ///< Whether overlap results are held in flat storage, rather than nested maps
+    TheMatrix m_overlapMatrix;                             ///< The overlap matrix, if not using flat storage
+    ClusterIndexMap m_clusterIndexMap1;                    ///< The view 1 cluster indices
+    ClusterIndexMap m_clusterIndexMap2;                    ///< The view 2 cluster indices
+    pandora::ClusterVector m_clusterVector1;               ///< The view 1 clusters, ordered by index
+    pandora::ClusterVector m_clusterVector2;               ///< The view 2 clusters, ordered by index
+    ResultIndexMap m_resultIndexMap;                       ///< The result index for each packed key
+    std::deque<OverlapResult> m_overlapResults;            ///< The overlap result storage, keeping references valid as results are added
+    std::vector<std::uint64_t> m_resultKeys;               ///< The packed key for each result index, or the invalid key if unused
+    mutable std::vector<unsigned int> m_freeResultIndices; ///< The unused result indices
+    mutable EntryList m_entryList;                         ///< The coordinate list of packed keys and result indices
+    mutable bool m_isEntryListSorted;                      ///< Whether the coordinate list is sorted by key
+    mutable unsigned int m_nStaleEntries;                  ///< The number of coordinate list entries for removed overlap results
+    mutable TheMatrix m_matrixView;                        ///< The nested map view of the flat storage
+    mutable bool m_isMatrixViewValid;                      ///< Whether the nested map view of the flat storage is up to date
+    ClusterNavigationMap m_clusterNavigationMap12;         ///< The cluster navigation map 1->2
+    ClusterNavigationMap m_clusterNavigationMap21;         ///< The cluster navigation map 2->1
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -261,10 +401,21 @@ inline void OverlapMatrix<T>::GetConnectedElements(const pandora::Cluster *const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+inline OverlapMatrix<T>::OverlapMatrix() :
+    m_useFlatStorage(false),
+    m_isEntryListSorted(true),
+    m_nStaleEntries(0),
+    m_isMatrixViewValid(true)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 inline typename OverlapMatrix<T>::const_iterator OverlapMatrix<T>::begin() const
 {
-    return m_overlapMatrix.begin();
+    return this->GetMatrixView().begin();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -272,7 +423,7 @@ inline typename OverlapMatrix<T>::const_iterator OverlapMatrix<T>::begin() const
 template <typename T>
 inline typename OverlapMatrix<T>::const_iterator OverlapMatrix<T>::end() const
 {
-    return m_overlapMatrix.end();
+    return this->GetMatrixView().end();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -281,13 +432,12 @@ template <typename T>
 inline const typename OverlapMatrix<T>::OverlapResult &OverlapMatrix<T>::GetOverlapResult(
     const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2) const
 {
-    const OverlapList &overlapList(this->GetOverlapList(pCluster1));
-    typename OverlapList::const_iterator iter = overlapList.find(pCluster2);
+    const OverlapResult *const pOverlapResult(this->FindOverlapResult(pCluster1, pCluster2));
 
-    if (overlapList.end() == iter)
+    if (!pOverlapResult)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
 
-    return iter->second;
+    return *pOverlapResult;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -295,9 +445,10 @@ inline const typename OverlapMatrix<T>::OverlapResult &OverlapMatrix<T>::GetOver
 template <typename T>
 inline const typename OverlapMatrix<T>::OverlapList &OverlapMatrix<T>::GetOverlapList(const pandora::Cluster *const pCluster1) const
 {
-    typename TheMatrix::const_iterator iter = m_overlapMatrix.find(pCluster1);
+    const TheMatrix &overlapMatrix(this->GetMatrixView());
+    typename TheMatrix::const_iterator iter = overlapMatrix.find(pCluster1);
 
-    if (m_overlapMatrix.end() == iter)
+    if (overlapMatrix.end() == iter)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
 
     return iter->second;
@@ -325,6 +476,19 @@ template <typename T>
 inline void OverlapMatrix<T>::Clear()
 {
     m_overlapMatrix.clear();
+    m_clusterIndexMap1.clear();
+    m_clusterIndexMap2.clear();
+    m_clusterVector1.clear();
+    m_clusterVector2.clear();
+    m_resultIndexMap.clear();
+    m_overlapResults.clear();
+    m_resultKeys.clear();
+    m_freeResultIndices.clear();
+    m_entryList.clear();
+    m_isEntryListSorted = true;
+    m_nStaleEntries = 0;
+    m_matrixView.clear();
+    m_isMatrixViewValid = true;
     m_clusterNavigationMap12.clear();
     m_clusterNavigationMap21.clear();
 }
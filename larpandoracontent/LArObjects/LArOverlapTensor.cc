@@ -21,12 +21,21 @@
 #include "larpandoracontent/LArObjects/LArTrackOverlapResult.h"
 
 #include <algorithm>
+#include <limits>
 
 using namespace pandora;
 
 namespace lar_content
 {
 
+template <typename T>
+const unsigned int OverlapTensor<T>::m_nKeyBits = 21;
+
+template <typename T>
+const std::uint64_t OverlapTensor<T>::m_invalidKey = std::numeric_limits<std::uint64_t>::max();
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 const Cluster *OverlapTensor<T>::Element::GetCluster(const HitType hitType) const
 {
@@ -41,32 +50,32 @@ const Cluster *OverlapTensor<T>::Element::GetCluster(const HitType hitType) cons
 template <typename T>
 void OverlapTensor<T>::GetUnambiguousElements(const bool ignoreUnavailable, ElementList &elementList) const
 {
-    for (typename TheTensor::const_iterator iterU = this->begin(), iterUEnd = this->end(); iterU != iterUEnd; ++iterU)
+    ClusterVector keyClusters;
+    this->GetKeyClusters(keyClusters);
+
+    for (const Cluster *const pKeyCluster : keyClusters)
     {
         ElementList tempElementList;
         ClusterList clusterListU, clusterListV, clusterListW;
-        this->GetConnectedElements(iterU->first, ignoreUnavailable, tempElementList, clusterListU, clusterListV, clusterListW);
+        this->GetConnectedElements(pKeyCluster, ignoreUnavailable, tempElementList, clusterListU, clusterListV, clusterListW);
 
         const Cluster *pClusterU(nullptr), *pClusterV(nullptr), *pClusterW(nullptr);
         if (!this->DefaultAmbiguityFunction(clusterListU, clusterListV, clusterListW, pClusterU, pClusterV, pClusterW))
             continue;
 
         // ATTN With HIT_CUSTOM definitions, it is possible to navigate from different U clusters to same combination
-        if (iterU->first != pClusterU)
+        if (pKeyCluster != pClusterU)
             continue;
 
         if (!pClusterU || !pClusterV || !pClusterW)
             continue;
 
-        typename OverlapMatrix::const_iterator iterV = iterU->second.find(pClusterV);
-        if (iterU->second.end() == iterV)
-            throw StatusCodeException(STATUS_CODE_FAILURE);
+        const OverlapResult *const pOverlapResult(this->FindOverlapResult(pClusterU, pClusterV, pClusterW));
 
-        typename OverlapList::const_iterator iterW = iterV->second.find(pClusterW);
-        if (iterV->second.end() == iterW)
+        if (!pOverlapResult)
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        Element element(pClusterU, pClusterV, pClusterW, iterW->second);
+        Element element(pClusterU, pClusterV, pClusterW, *pOverlapResult);
         elementList.push_back(element);
     }
 
@@ -104,40 +113,143 @@ void OverlapTensor<T>::GetConnectedElements(const pandora::Cluster *const pClust
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void OverlapTensor<T>::GetAllElements(const bool ignoreUnavailable, ElementList &elementList) const
+{
+    if (!m_useFlatStorage)
+    {
+        for (const typename TheTensor::value_type &matrixEntry : m_overlapTensor)
+        {
+            for (const typename OverlapMatrix::value_type &listEntry : matrixEntry.second)
+            {
+                for (const typename OverlapList::value_type &resultEntry : listEntry.second)
+                {
+                    if (ignoreUnavailable &&
+                        (!matrixEntry.first->IsAvailable() || !listEntry.first->IsAvailable() || !resultEntry.first->IsAvailable()))
+                        continue;
+
+                    elementList.push_back(Element(matrixEntry.first, listEntry.first, resultEntry.first, resultEntry.second));
+                }
+            }
+        }
+
+        return;
+    }
+
+    this->SortEntries();
+    const std::uint64_t indexMask((static_cast<std::uint64_t>(1) << m_nKeyBits) - 1);
+
+    for (const Entry &entry : m_entryList)
+    {
+        const Cluster *const pClusterU(m_clusterVectorU[entry.first >> (2 * m_nKeyBits)]);
+        const Cluster *const pClusterV(m_clusterVectorV[(entry.first >> m_nKeyBits) & indexMask]);
+        const Cluster *const pClusterW(m_clusterVectorW[entry.first & indexMask]);
+
+        if (ignoreUnavailable && (!pClusterU->IsAvailable() || !pClusterV->IsAvailable() || !pClusterW->IsAvailable()))
+            continue;
+
+        elementList.push_back(Element(pClusterU, pClusterV, pClusterW, m_overlapResults[entry.second]));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void OverlapTensor<T>::GetSortedKeyClusters(ClusterVector &sortedKeyClusters) const
 {
-    for (typename TheTensor::const_iterator iterU = this->begin(), iterUEnd = this->end(); iterU != iterUEnd; ++iterU)
-        sortedKeyClusters.push_back(iterU->first);
+    ClusterVector keyClusters;
+    this->GetKeyClusters(keyClusters);
+    sortedKeyClusters.insert(sortedKeyClusters.end(), keyClusters.begin(), keyClusters.end());
 
     std::sort(sortedKeyClusters.begin(), sortedKeyClusters.end(), LArClusterHelper::SortByNHits);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void OverlapTensor<T>::SetUseFlatStorage(const bool useFlatStorage)
+{
+    if (!m_overlapTensor.empty() || !m_resultIndexMap.empty() || !m_clusterNavigationMapUV.empty())
+        throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+
+    this->Clear();
+    m_useFlatStorage = useFlatStorage;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void OverlapTensor<T>::SetOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
     const pandora::Cluster *const pClusterW, const OverlapResult &overlapResult)
 {
-    OverlapList &overlapList = m_overlapTensor[pClusterU][pClusterV];
-    typename OverlapList::const_iterator iter = overlapList.find(pClusterW);
+    if (!m_useFlatStorage)
+    {
+        OverlapList &overlapList = m_overlapTensor[pClusterU][pClusterV];
+        typename OverlapList::const_iterator iter = overlapList.find(pClusterW);
 
-    if (overlapList.end() != iter)
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_ALREADY_PRESENT);
+        if (overlapList.end() != iter)
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_ALREADY_PRESENT);
 
-    if (!overlapList.insert(typename OverlapList::value_type(pClusterW, overlapResult)).second)
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+        if (!overlapList.insert(typename OverlapList::value_type(pClusterW, overlapResult)).second)
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+    }
+    else
+    {
+        const std::uint64_t key(OverlapTensor<T>::GetKey(OverlapTensor<T>::GetOrAddClusterIndex(pClusterU, m_clusterIndexMapU, m_clusterVectorU),
+            OverlapTensor<T>::GetOrAddClusterIndex(pClusterV, m_clusterIndexMapV, m_clusterVectorV),
+            OverlapTensor<T>::GetOrAddClusterIndex(pClusterW, m_clusterIndexMapW, m_clusterVectorW)));
+
+        if (m_resultIndexMap.count(key))
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_ALREADY_PRESENT);
+
+        unsigned int resultIndex(m_overlapResults.size());
+
+        if (!m_freeResultIndices.empty())
+        {
+            resultIndex = m_freeResultIndices.back();
+            m_overlapResults[resultIndex] = overlapResult;
+            m_resultKeys[resultIndex] = key;
+            m_freeResultIndices.pop_back();
+        }
+        else
+        {
+            m_overlapResults.push_back(overlapResult);
+            m_resultKeys.push_back(key);
+        }
+
+        if (!m_resultIndexMap.insert(typename ResultIndexMap::value_type(key, resultIndex)).second)
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+
+        if (!m_entryList.empty() && (m_entryList.back().first > key))
+            m_isEntryListSorted = false;
+
+        m_entryList.emplace_back(key, resultIndex);
+        m_isTensorViewValid = false;
+    }
+
+    m_modificationLog.insert(m_modificationLog.end(), {pClusterU, pClusterV, pClusterW});
 
     ClusterList &navigationUV(m_clusterNavigationMapUV[pClusterU]);
     ClusterList &navigationVW(m_clusterNavigationMapVW[pClusterV]);
     ClusterList &navigationWU(m_clusterNavigationMapWU[pClusterW]);
 
     if (navigationUV.end() == std::find(navigationUV.begin(), navigationUV.end(), pClusterV))
+    {
         navigationUV.push_back(pClusterV);
+        this->AddAdjacentClusters(pClusterU, pClusterV);
+    }
+
     if (navigationVW.end() == std::find(navigationVW.begin(), navigationVW.end(), pClusterW))
+    {
         navigationVW.push_back(pClusterW);
+        this->AddAdjacentClusters(pClusterV, pClusterW);
+    }
+
     if (navigationWU.end() == std::find(navigationWU.begin(), navigationWU.end(), pClusterU))
+    {
         navigationWU.push_back(pClusterU);
+        this->AddAdjacentClusters(pClusterW, pClusterU);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -146,22 +258,39 @@ template <typename T>
 void OverlapTensor<T>::ReplaceOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
     const pandora::Cluster *const pClusterW, const OverlapResult &overlapResult)
 {
-    typename TheTensor::iterator iterU = m_overlapTensor.find(pClusterU);
+    if (!m_useFlatStorage)
+    {
+        typename TheTensor::iterator iterU = m_overlapTensor.find(pClusterU);
 
-    if (m_overlapTensor.end() == iterU)
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+        if (m_overlapTensor.end() == iterU)
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
 
-    typename OverlapMatrix::iterator iterV = iterU->second.find(pClusterV);
+        typename OverlapMatrix::iterator iterV = iterU->second.find(pClusterV);
 
-    if (iterU->second.end() == iterV)
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+        if (iterU->second.end() == iterV)
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+        typename OverlapList::iterator iterW = iterV->second.find(pClusterW);
 
-    typename OverlapList::iterator iterW = iterV->second.find(pClusterW);
+        if (iterV->second.end() == iterW)
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
 
-    if (iterV->second.end() == iterW)
-        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+        iterW->second = overlapResult;
+    }
+    else
+    {
+        std::uint64_t key(0);
+        typename ResultIndexMap::const_iterator iter(
+            this->GetKey(pClusterU, pClusterV, pClusterW, key) ? m_resultIndexMap.find(key) : m_resultIndexMap.end());
 
-    iterW->second = overlapResult;
+        if (m_resultIndexMap.end() == iter)
+            throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+        m_overlapResults[iter->second] = overlapResult;
+        m_isTensorViewValid = false;
+    }
+
+    m_modificationLog.insert(m_modificationLog.end(), {pClusterU, pClusterV, pClusterW});
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -170,13 +299,13 @@ template <typename T>
 void OverlapTensor<T>::RemoveCluster(const pandora::Cluster *const pCluster)
 {
     ClusterList additionalRemovals;
+    m_modificationLog.push_back(pCluster);
+    m_unavailableClusters.erase(pCluster);
+    this->RemoveAdjacentClusters(pCluster);
 
     if (m_clusterNavigationMapUV.erase(pCluster) > 0)
     {
-        typename TheTensor::iterator iter = m_overlapTensor.find(pCluster);
-
-        if (m_overlapTensor.end() != iter)
-            m_overlapTensor.erase(iter);
+        this->RemoveOverlapResults(pCluster, TPC_VIEW_U);
 
         for (ClusterNavigationMap::iterator navIter = m_clusterNavigationMapWU.begin(); navIter != m_clusterNavigationMapWU.end();)
         {
@@ -184,7 +313,10 @@ void OverlapTensor<T>::RemoveCluster(const pandora::Cluster *const pCluster)
             ClusterList::iterator listIter = std::find(thisIter->second.begin(), thisIter->second.end(), pCluster);
 
             if (thisIter->second.end() != listIter)
+            {
                 thisIter->second.erase(listIter);
+                m_modificationLog.push_back(thisIter->first);
+            }
 
             if (thisIter->second.empty())
                 additionalRemovals.push_back(thisIter->first);
@@ -193,13 +325,7 @@ void OverlapTensor<T>::RemoveCluster(const pandora::Cluster *const pCluster)
 
     if (m_clusterNavigationMapVW.erase(pCluster) > 0)
     {
-        for (typename TheTensor::iterator iterU = m_overlapTensor.begin(), iterUEnd = m_overlapTensor.end(); iterU != iterUEnd; ++iterU)
-        {
-            typename OverlapMatrix::iterator iter = iterU->second.find(pCluster);
-
-            if (iterU->second.end() != iter)
-                iterU->second.erase(iter);
-        }
+        this->RemoveOverlapResults(pCluster, TPC_VIEW_V);
 
         for (ClusterNavigationMap::iterator navIter = m_clusterNavigationMapUV.begin(); navIter != m_clusterNavigationMapUV.end();)
         {
@@ -207,7 +333,10 @@ void OverlapTensor<T>::RemoveCluster(const pandora::Cluster *const pCluster)
             ClusterList::iterator listIter = std::find(thisIter->second.begin(), thisIter->second.end(), pCluster);
 
             if (thisIter->second.end() != listIter)
+            {
                 thisIter->second.erase(listIter);
+                m_modificationLog.push_back(thisIter->first);
+            }
 
             if (thisIter->second.empty())
                 additionalRemovals.push_back(thisIter->first);
@@ -216,16 +345,7 @@ void OverlapTensor<T>::RemoveCluster(const pandora::Cluster *const pCluster)
 
     if (m_clusterNavigationMapWU.erase(pCluster) > 0)
     {
-        for (typename TheTensor::iterator iterU = m_overlapTensor.begin(), iterUEnd = m_overlapTensor.end(); iterU != iterUEnd; ++iterU)
-        {
-            for (typename OverlapMatrix::iterator iterV = iterU->second.begin(), iterVEnd = iterU->second.end(); iterV != iterVEnd; ++iterV)
-            {
-                typename OverlapList::iterator iter = iterV->second.find(pCluster);
-
-                if (iterV->second.end() != iter)
-                    iterV->second.erase(iter);
-            }
-        }
+        this->RemoveOverlapResults(pCluster, TPC_VIEW_W);
 
         for (ClusterNavigationMap::iterator navIter = m_clusterNavigationMapVW.begin(); navIter != m_clusterNavigationMapVW.end();)
         {
@@ -233,13 +353,18 @@ void OverlapTensor<T>::RemoveCluster(const pandora::Cluster *const pCluster)
             ClusterList::iterator listIter = std::find(thisIter->second.begin(), thisIter->second.end(), pCluster);
 
             if (thisIter->second.end() != listIter)
+            {
                 thisIter->second.erase(listIter);
+                m_modificationLog.push_back(thisIter->first);
+            }
 
             if (thisIter->second.empty())
                 additionalRemovals.push_back(thisIter->first);
         }
     }
 
+    // ATTN The navigation maps define the keys of the nested map view of flat storage, so it is out of date even if no results were removed
+    m_isTensorViewValid = false;
     additionalRemovals.sort(LArClusterHelper::SortByNHits);
 
     for (ClusterList::const_iterator iter = additionalRemovals.begin(), iterEnd = additionalRemovals.end(); iter != iterEnd; ++iter)
@@ -248,12 +373,30 @@ void OverlapTensor<T>::RemoveCluster(const pandora::Cluster *const pCluster)
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void OverlapTensor<T>::RecordAvailabilityChanges(const ClusterList &clusterList)
+{
+    for (const Cluster *const pCluster : clusterList)
+    {
+        if (!m_adjacentClusterMap.count(pCluster))
+            continue;
+
+        const bool isAvailable(pCluster->IsAvailable());
+
+        if (isAvailable ? (m_unavailableClusters.erase(pCluster) > 0) : m_unavailableClusters.insert(pCluster).second)
+            m_modificationLog.push_back(pCluster);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void OverlapTensor<T>::GetConnectedElements(const Cluster *const pCluster, const bool ignoreUnavailable, ElementList &elementList,
     ClusterList &clusterListU, ClusterList &clusterListV, ClusterList &clusterListW) const
 {
+    ArenaClusterSet exploredClusters(EventArena::GetResource());
     ClusterList localClusterListU, localClusterListV, localClusterListW;
-    this->ExploreConnections(pCluster, ignoreUnavailable, localClusterListU, localClusterListV, localClusterListW);
+    this->ExploreConnections(pCluster, ignoreUnavailable, exploredClusters, localClusterListU, localClusterListV, localClusterListW);
 
     // ATTN Now need to check that all clusters received are from fully available tensor elements
     elementList.clear();
@@ -261,29 +404,82 @@ void OverlapTensor<T>::GetConnectedElements(const Cluster *const pCluster, const
     clusterListV.clear();
     clusterListW.clear();
 
-    for (typename TheTensor::const_iterator iterU = this->begin(), iterUEnd = this->end(); iterU != iterUEnd; ++iterU)
+    ArenaClusterSet connectedClusters(EventArena::GetResource());
+
+    if (!m_useFlatStorage)
     {
-        if (localClusterListU.end() == std::find(localClusterListU.begin(), localClusterListU.end(), iterU->first))
-            continue;
+        ArenaClusterSet localClustersU(EventArena::GetResource());
+        localClustersU.insert(localClusterListU.begin(), localClusterListU.end());
 
-        for (typename OverlapMatrix::const_iterator iterV = iterU->second.begin(), iterVEnd = iterU->second.end(); iterV != iterVEnd; ++iterV)
+        for (const typename TheTensor::value_type &matrixEntry : m_overlapTensor)
         {
-            for (typename OverlapList::const_iterator iterW = iterV->second.begin(), iterWEnd = iterV->second.end(); iterW != iterWEnd; ++iterW)
+            const Cluster *const pClusterU(matrixEntry.first);
+
+            if (!localClustersU.count(pClusterU))
+                continue;
+
+            for (const typename OverlapMatrix::value_type &listEntry : matrixEntry.second)
             {
-                if (ignoreUnavailable && (!iterU->first->IsAvailable() || !iterV->first->IsAvailable() || !iterW->first->IsAvailable()))
-                    continue;
-
-                Element element(iterU->first, iterV->first, iterW->first, iterW->second);
-                elementList.push_back(element);
-
-                if (clusterListU.end() == std::find(clusterListU.begin(), clusterListU.end(), iterU->first))
-                    clusterListU.push_back(iterU->first);
-                if (clusterListV.end() == std::find(clusterListV.begin(), clusterListV.end(), iterV->first))
-                    clusterListV.push_back(iterV->first);
-                if (clusterListW.end() == std::find(clusterListW.begin(), clusterListW.end(), iterW->first))
-                    clusterListW.push_back(iterW->first);
+                for (const typename OverlapList::value_type &resultEntry : listEntry.second)
+                {
+                    const Cluster *const pClusterV(listEntry.first), *const pClusterW(resultEntry.first);
+
+                    if (ignoreUnavailable && (!pClusterU->IsAvailable() || !pClusterV->IsAvailable() || !pClusterW->IsAvailable()))
+                        continue;
+
+                    Element element(pClusterU, pClusterV, pClusterW, resultEntry.second);
+                    elementList.push_back(element);
+
+                    if (connectedClusters.insert(pClusterU).second)
+                        clusterListU.push_back(pClusterU);
+                    if (connectedClusters.insert(pClusterV).second)
+                        clusterListV.push_back(pClusterV);
+                    if (connectedClusters.insert(pClusterW).second)
+                        clusterListW.push_back(pClusterW);
+                }
             }
         }
+
+        std::sort(elementList.begin(), elementList.end());
+        return;
+    }
+
+    // ATTN Only visit the flat storage entries for the connected u clusters, so that the cost scales with the size of the connected component
+    this->SortEntries();
+    const std::uint64_t indexMask((static_cast<std::uint64_t>(1) << m_nKeyBits) - 1);
+
+    for (const Cluster *const pClusterU : localClusterListU)
+    {
+        ClusterIndexMap::const_iterator indexIter(m_clusterIndexMapU.find(pClusterU));
+
+        if (m_clusterIndexMapU.end() == indexIter)
+            continue;
+
+        // ATTN The coordinate list is sorted by key, with the u index in the most significant bits
+        const Entry firstEntry(OverlapTensor<T>::GetKey(indexIter->second, 0, 0), 0);
+        typename EntryList::const_iterator iter(std::lower_bound(m_entryList.begin(), m_entryList.end(), firstEntry));
+
+        for (typename EntryList::const_iterator iterEnd = m_entryList.end(); iter != iterEnd; ++iter)
+        {
+            if ((iter->first >> (2 * m_nKeyBits)) != indexIter->second)
+                break;
+
+            const Cluster *const pClusterV(m_clusterVectorV[(iter->first >> m_nKeyBits) & indexMask]);
+            const Cluster *const pClusterW(m_clusterVectorW[iter->first & indexMask]);
+
+            if (ignoreUnavailable && (!pClusterU->IsAvailable() || !pClusterV->IsAvailable() || !pClusterW->IsAvailable()))
+                continue;
+
+            Element element(pClusterU, pClusterV, pClusterW, m_overlapResults[iter->second]);
+            elementList.push_back(element);
+
+            if (connectedClusters.insert(pClusterU).second)
+                clusterListU.push_back(pClusterU);
+            if (connectedClusters.insert(pClusterV).second)
+                clusterListV.push_back(pClusterV);
+            if (connectedClusters.insert(pClusterW).second)
+                clusterListW.push_back(pClusterW);
+        }
     }
 
     std::sort(elementList.begin(), elementList.end());
@@ -292,8 +488,8 @@ void OverlapTensor<T>::GetConnectedElements(const Cluster *const pCluster, const
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename T>
-void OverlapTensor<T>::ExploreConnections(const Cluster *const pCluster, const bool ignoreUnavailable, ClusterList &clusterListU,
-    ClusterList &clusterListV, ClusterList &clusterListW) const
+void OverlapTensor<T>::ExploreConnections(const Cluster *const pCluster, const bool ignoreUnavailable, ArenaClusterSet &exploredClusters,
+    ClusterList &clusterListU, ClusterList &clusterListV, ClusterList &clusterListW) const
 {
     if (ignoreUnavailable && !pCluster->IsAvailable())
         return;
@@ -307,7 +503,7 @@ void OverlapTensor<T>::ExploreConnections(const Cluster *const pCluster, const b
     const ClusterNavigationMap &navigationMap(
         (TPC_VIEW_U == hitType) ? m_clusterNavigationMapUV : (TPC_VIEW_V == hitType) ? m_clusterNavigationMapVW : m_clusterNavigationMapWU);
 
-    if (clusterList.end() != std::find(clusterList.begin(), clusterList.end(), pCluster))
+    if (!exploredClusters.insert(pCluster).second)
         return;
 
     clusterList.push_back(pCluster);
@@ -317,7 +513,348 @@ void OverlapTensor<T>::ExploreConnections(const Cluster *const pCluster, const b
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
     for (ClusterList::const_iterator cIter = iter->second.begin(), cIterEnd = iter->second.end(); cIter != cIterEnd; ++cIter)
-        this->ExploreConnections(*cIter, ignoreUnavailable, clusterListU, clusterListV, clusterListW);
+        this->ExploreConnections(*cIter, ignoreUnavailable, exploredClusters, clusterListU, clusterListV, clusterListW);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapTensor<T>::GetKeyClusters(ClusterVector &keyClusters) const
+{
+    ArenaClusterSet componentClusters(EventArena::GetResource());
+
+    if (m_isRestricted)
+        this->GetModifiedComponentClusters(componentClusters);
+
+    if (!m_useFlatStorage)
+    {
+        for (const typename TheTensor::value_type &matrixEntry : m_overlapTensor)
+        {
+            if (!m_isRestricted || componentClusters.count(matrixEntry.first))
+                keyClusters.push_back(matrixEntry.first);
+        }
+
+        return;
+    }
+
+    // ATTN With flat storage, the key clusters are exactly those with u->v navigation entries
+    for (const ClusterNavigationMap::value_type &mapEntry : m_clusterNavigationMapUV)
+    {
+        if (!m_isRestricted || componentClusters.count(mapEntry.first))
+            keyClusters.push_back(mapEntry.first);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapTensor<T>::GetModifiedComponentClusters(ArenaClusterSet &componentClusters) const
+{
+    // ATTN Navigate in both directions, so that each component contains everything explored from any of its key clusters
+    ArenaClusterVector clustersToExplore(EventArena::GetResource());
+
+    for (std::size_t logIndex = m_restrictionLogPosition; logIndex < m_modificationLog.size(); ++logIndex)
+    {
+        const Cluster *const pCluster(m_modificationLog[logIndex]);
+
+        if (m_adjacentClusterMap.count(pCluster) && componentClusters.insert(pCluster).second)
+            clustersToExplore.push_back(pCluster);
+    }
+
+    while (!clustersToExplore.empty())
+    {
+        const Cluster *const pCluster(clustersToExplore.back());
+        clustersToExplore.pop_back();
+
+        for (const Cluster *const pAdjacentCluster : m_adjacentClusterMap.at(pCluster))
+        {
+            if (componentClusters.insert(pAdjacentCluster).second)
+                clustersToExplore.push_back(pAdjacentCluster);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapTensor<T>::AddAdjacentClusters(const Cluster *const pCluster1, const Cluster *const pCluster2)
+{
+    m_adjacentClusterMap[pCluster1].push_back(pCluster2);
+    m_adjacentClusterMap[pCluster2].push_back(pCluster1);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapTensor<T>::RemoveAdjacentClusters(const Cluster *const pCluster)
+{
+    typename AdjacentClusterMap::iterator iter(m_adjacentClusterMap.find(pCluster));
+
+    if (m_adjacentClusterMap.end() == iter)
+        return;
+
+    for (const Cluster *const pAdjacentCluster : iter->second)
+    {
+        typename AdjacentClusterMap::iterator adjacentIter(m_adjacentClusterMap.find(pAdjacentCluster));
+
+        if (m_adjacentClusterMap.end() == adjacentIter)
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        ClusterVector &adjacentClusters(adjacentIter->second);
+        ClusterVector::iterator clusterIter(std::find(adjacentClusters.begin(), adjacentClusters.end(), pCluster));
+
+        if (adjacentClusters.end() == clusterIter)
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        adjacentClusters.erase(clusterIter);
+
+        if (adjacentClusters.empty())
+            m_adjacentClusterMap.erase(adjacentIter);
+    }
+
+    m_adjacentClusterMap.erase(iter);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+unsigned int OverlapTensor<T>::GetOrAddClusterIndex(const Cluster *const pCluster, ClusterIndexMap &clusterIndexMap, ClusterVector &clusterVector)
+{
+    const std::pair<ClusterIndexMap::const_iterator, bool> insertion(
+        clusterIndexMap.insert(ClusterIndexMap::value_type(pCluster, clusterVector.size())));
+
+    if (insertion.second)
+    {
+        if (clusterVector.size() >= (static_cast<std::size_t>(1) << m_nKeyBits))
+        {
+            clusterIndexMap.erase(pCluster);
+            throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+        }
+
+        clusterVector.push_back(pCluster);
+    }
+
+    return insertion.first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+bool OverlapTensor<T>::GetKey(
+    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW, std::uint64_t &key) const
+{
+    ClusterIndexMap::const_iterator iterU(m_clusterIndexMapU.find(pClusterU));
+    ClusterIndexMap::const_iterator iterV(m_clusterIndexMapV.find(pClusterV));
+    ClusterIndexMap::const_iterator iterW(m_clusterIndexMapW.find(pClusterW));
+
+    if ((m_clusterIndexMapU.end() == iterU) || (m_clusterIndexMapV.end() == iterV) || (m_clusterIndexMapW.end() == iterW))
+        return false;
+
+    key = OverlapTensor<T>::GetKey(iterU->second, iterV->second, iterW->second);
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+std::uint64_t OverlapTensor<T>::GetKey(const unsigned int indexU, const unsigned int indexV, const unsigned int indexW)
+{
+    return ((static_cast<std::uint64_t>(indexU) << (2 * m_nKeyBits)) | (static_cast<std::uint64_t>(indexV) << m_nKeyBits) |
+        static_cast<std::uint64_t>(indexW));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+bool OverlapTensor<T>::IsCurrentEntry(const Entry &entry) const
+{
+    return (m_resultKeys[entry.second] == entry.first);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+const typename OverlapTensor<T>::OverlapResult *OverlapTensor<T>::FindOverlapResult(
+    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW) const
+{
+    if (m_useFlatStorage)
+    {
+        std::uint64_t key(0);
+        typename ResultIndexMap::const_iterator iter(
+            this->GetKey(pClusterU, pClusterV, pClusterW, key) ? m_resultIndexMap.find(key) : m_resultIndexMap.end());
+
+        return ((m_resultIndexMap.end() == iter) ? nullptr : &m_overlapResults[iter->second]);
+    }
+
+    typename TheTensor::const_iterator iterU = m_overlapTensor.find(pClusterU);
+
+    if (m_overlapTensor.end() == iterU)
+        return nullptr;
+
+    typename OverlapMatrix::const_iterator iterV = iterU->second.find(pClusterV);
+
+    if (iterU->second.end() == iterV)
+        return nullptr;
+
+    typename OverlapList::const_iterator iterW = iterV->second.find(pClusterW);
+
+    return ((iterV->second.end() == iterW) ? nullptr : &iterW->second);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapTensor<T>::RemoveOverlapResults(const Cluster *const pCluster, const HitType hitType)
+{
+    if (!m_useFlatStorage && (TPC_VIEW_U == hitType))
+    {
+        typename TheTensor::iterator iterU = m_overlapTensor.find(pCluster);
+
+        if (m_overlapTensor.end() == iterU)
+            return;
+
+        for (const typename OverlapMatrix::value_type &listEntry : iterU->second)
+        {
+            for (const typename OverlapList::value_type &resultEntry : listEntry.second)
+                m_modificationLog.insert(m_modificationLog.end(), {pCluster, listEntry.first, resultEntry.first});
+        }
+
+        m_overlapTensor.erase(iterU);
+        return;
+    }
+
+    if (!m_useFlatStorage && (TPC_VIEW_V == hitType))
+    {
+        for (typename TheTensor::value_type &matrixEntry : m_overlapTensor)
+        {
+            typename OverlapMatrix::iterator iterV = matrixEntry.second.find(pCluster);
+
+            if (matrixEntry.second.end() == iterV)
+                continue;
+
+            for (const typename OverlapList::value_type &resultEntry : iterV->second)
+                m_modificationLog.insert(m_modificationLog.end(), {matrixEntry.first, pCluster, resultEntry.first});
+
+            matrixEntry.second.erase(iterV);
+        }
+
+        return;
+    }
+
+    if (!m_useFlatStorage)
+    {
+        for (typename TheTensor::value_type &matrixEntry : m_overlapTensor)
+        {
+            for (typename OverlapMatrix::value_type &listEntry : matrixEntry.second)
+            {
+                if (listEntry.second.erase(pCluster) > 0)
+                    m_modificationLog.insert(m_modificationLog.end(), {matrixEntry.first, listEntry.first, pCluster});
+            }
+        }
+
+        return;
+    }
+
+    const ClusterIndexMap &clusterIndexMap(
+        (TPC_VIEW_U == hitType) ? m_clusterIndexMapU : (TPC_VIEW_V == hitType) ? m_clusterIndexMapV : m_clusterIndexMapW);
+    const unsigned int keyShift((TPC_VIEW_U == hitType) ? 2 * m_nKeyBits : (TPC_VIEW_V == hitType) ? m_nKeyBits : 0);
+    ClusterIndexMap::const_iterator indexIter(clusterIndexMap.find(pCluster));
+
+    if (clusterIndexMap.end() == indexIter)
+        return;
+
+    const std::uint64_t indexMask((static_cast<std::uint64_t>(1) << m_nKeyBits) - 1);
+
+    for (const Entry &entry : m_entryList)
+    {
+        if ((((entry.first >> keyShift) & indexMask) != indexIter->second) || !this->IsCurrentEntry(entry))
+            continue;
+
+        m_modificationLog.insert(m_modificationLog.end(), {m_clusterVectorU[entry.first >> (2 * m_nKeyBits)],
+            m_clusterVectorV[(entry.first >> m_nKeyBits) & indexMask], m_clusterVectorW[entry.first & indexMask]});
+        this->RemoveOverlapResult(entry.second);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapTensor<T>::RemoveOverlapResult(const unsigned int resultIndex)
+{
+    m_resultIndexMap.erase(m_resultKeys[resultIndex]);
+    m_resultKeys[resultIndex] = m_invalidKey;
+
+    // ATTN The coordinate list entry is now stale, and the result index is only reused once the entry has been dropped
+    ++m_nStaleEntries;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void OverlapTensor<T>::SortEntries() const
+{
+    if (m_nStaleEntries > 0)
+    {
+        typename EntryList::iterator outputIter(m_entryList.begin());
+
+        for (const Entry &entry : m_entryList)
+        {
+            if (this->IsCurrentEntry(entry))
+            {
+                *outputIter++ = entry;
+            }
+            else
+            {
+                m_freeResultIndices.push_back(entry.second);
+            }
+        }
+
+        m_entryList.erase(outputIter, m_entryList.end());
+        m_nStaleEntries = 0;
+    }
+
+    if (!m_isEntryListSorted)
+    {
+        std::sort(m_entryList.begin(), m_entryList.end());
+        m_isEntryListSorted = true;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+const typename OverlapTensor<T>::TheTensor &OverlapTensor<T>::GetTensorView() const
+{
+    if (!m_useFlatStorage)
+        return m_overlapTensor;
+
+    if (m_isTensorViewValid)
+        return m_tensorView;
+
+    m_tensorView.clear();
+
+    // ATTN Each u->v navigation entry corresponds to a (possibly empty) overlap list, as for the original nested map storage
+    for (const ClusterNavigationMap::value_type &mapEntry : m_clusterNavigationMapUV)
+    {
+        OverlapMatrix &overlapMatrix(m_tensorView[mapEntry.first]);
+
+        for (const Cluster *const pClusterV : mapEntry.second)
+            overlapMatrix[pClusterV];
+    }
+
+    this->SortEntries();
+    const std::uint64_t indexMask((static_cast<std::uint64_t>(1) << m_nKeyBits) - 1);
+
+    for (const Entry &entry : m_entryList)
+    {
+        const Cluster *const pClusterU(m_clusterVectorU[entry.first >> (2 * m_nKeyBits)]);
+        const Cluster *const pClusterV(m_clusterVectorV[(entry.first >> m_nKeyBits) & indexMask]);
+        const Cluster *const pClusterW(m_clusterVectorW[entry.first & indexMask]);
+        m_tensorView[pClusterU][pClusterV].insert(typename OverlapList::value_type(pClusterW, m_overlapResults[entry.second]));
+    }
+
+    m_isTensorViewValid = true;
+    return m_tensorView;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -10,6 +10,12 @@
 
 #include "Pandora/PandoraInternal.h"
 
+#include "larpandoracontent/LArObjects/LArEventArena.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
 #include <unordered_map>
 #include <vector>
 
@@ -17,7 +23,9 @@ namespace lar_content
 {
 
 /**
- *  @brief  OverlapTensor class
+ *  @brief  OverlapTensor class. Overlap results are held in nested maps unless flat storage is selected via SetUseFlatStorage. With flat
+ *          storage, clusters are assigned dense indices per view, results are kept in block-contiguous storage addressed via packed
+ *          (u, v, w) index keys, and a lazily sorted coordinate list provides contiguous iteration over the results for each u cluster.
  */
 template <typename T>
 class OverlapTensor
@@ -95,6 +103,11 @@ public:
 
     typedef std::vector<Element> ElementList;
 
+    /**
+     *  @brief  Default constructor
+     */
+    OverlapTensor();
+
     /**
      *  @brief  Get unambiguous elements
      *
@@ -152,6 +165,15 @@ public:
     void GetConnectedElements(const pandora::Cluster *const pCluster, const bool ignoreUnavailable, ElementList &elementList,
         unsigned int &nU, unsigned int &nV, unsigned int &nW) const;
 
+    /**
+     *  @brief  Get a list of all elements, grouped by u cluster. With flat storage, the elements are in coordinate list order and the nested
+     *          map view is not built.
+     *
+     *  @param  ignoreUnavailable whether to ignore unavailable clusters
+     *  @param  elementList to receive the element list
+     */
+    void GetAllElements(const bool ignoreUnavailable, ElementList &elementList) const;
+
     typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterList> ClusterNavigationMap;
     typedef std::unordered_map<const pandora::Cluster *, OverlapResult> OverlapList;
     typedef std::unordered_map<const pandora::Cluster *, OverlapList> OverlapMatrix;
@@ -160,7 +182,9 @@ public:
     typedef typename TheTensor::const_iterator const_iterator;
 
     /**
-     *  @brief  Returns an iterator referring to the first element in the overlap tensor
+     *  @brief  Returns an iterator referring to the first element in the overlap tensor. With flat storage, this is an iterator into a
+     *          nested map view that is rebuilt by the first view access (begin, end, GetOverlapMatrix or GetOverlapList) following any
+     *          modification, and which is then invalidated.
      */
     const_iterator begin() const;
 
@@ -194,7 +218,7 @@ public:
      *  @param  pClusterU address of cluster u
      *  @param  pClusterV address of cluster v
      *
-     *  @return the cluster overlap list
+     *  @return the cluster overlap list, which with flat storage is invalidated as for begin
      */
     const OverlapList &GetOverlapList(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV) const;
 
@@ -203,7 +227,7 @@ public:
      *
      *  @param  pClusterU address of cluster u
      *
-     *  @return the cluster overlap matrix
+     *  @return the cluster overlap matrix, which with flat storage is invalidated as for begin
      */
     const OverlapMatrix &GetOverlapMatrix(const pandora::Cluster *const pClusterU) const;
 
@@ -228,6 +252,14 @@ public:
      */
     const ClusterNavigationMap &GetClusterNavigationMapWU() const;
 
+    /**
+     *  @brief  Select whether overlap results are held in flat storage, rather than in nested maps. With flat storage, const member
+     *          functions may compact and sort the coordinate list and rebuild the nested map view, so must not be called concurrently.
+     *
+     *  @param  useFlatStorage whether to use flat storage
+     */
+    void SetUseFlatStorage(const bool useFlatStorage);
+
     /**
      *  @brief  Set overlap result
      *
@@ -257,6 +289,37 @@ public:
      */
     void RemoveCluster(const pandora::Cluster *const pCluster);
 
+    /**
+     *  @brief  Get the size of the modification log, identifying the current state of the overlap tensor. Clusters are logged when overlap
+     *          results involving them are set, replaced or removed, when their navigation entries change and when a change in their
+     *          availability is recorded.
+     *
+     *  @return the size of the modification log
+     */
+    std::size_t GetModificationLogSize() const;
+
+    /**
+     *  @brief  Log those clusters in a list whose availability has changed since it was last recorded, e.g. following particle creation
+     *
+     *  @param  clusterList the list of clusters whose availability may have changed
+     */
+    void RecordAvailabilityChanges(const pandora::ClusterList &clusterList);
+
+    /**
+     *  @brief  Restrict the key clusters, as returned by GetSortedKeyClusters and examined by GetUnambiguousElements, to those in connected
+     *          components containing a cluster logged at or after a given log position. Components are defined by navigation in either
+     *          direction, irrespective of cluster availability. They are found from an adjacency map maintained as navigation entries are added
+     *          and removed, so follow any later modifications.
+     *
+     *  @param  logPosition the log position
+     */
+    void RestrictToModifiedComponents(const std::size_t logPosition);
+
+    /**
+     *  @brief  Remove any restriction of the key clusters
+     */
+    void ClearRestriction();
+
     /**
      *  @brief  Clear overlap tensor
      */
@@ -279,17 +342,164 @@ private:
      *  @brief  Explore connections associated with a given cluster
      *
      *  @param  pCluster address of the cluster
+     *  @param  ignoreUnavailable whether to ignore unavailable clusters
+     *  @param  exploredClusters the clusters already explored
      *  @param  clusterListU connected u clusters
      *  @param  clusterListV connected v clusters
      *  @param  clusterListW connected w clusters
      */
-    void ExploreConnections(const pandora::Cluster *const pCluster, const bool ignoreUnavailable, pandora::ClusterList &clusterListU,
-        pandora::ClusterList &clusterListV, pandora::ClusterList &clusterListW) const;
+    void ExploreConnections(const pandora::Cluster *const pCluster, const bool ignoreUnavailable, ArenaClusterSet &exploredClusters,
+        pandora::ClusterList &clusterListU, pandora::ClusterList &clusterListV, pandora::ClusterList &clusterListW) const;
+
+    typedef std::unordered_map<const pandora::Cluster *, unsigned int> ClusterIndexMap;
+    typedef std::unordered_map<std::uint64_t, unsigned int> ResultIndexMap;
+    typedef std::pair<std::uint64_t, unsigned int> Entry;
+    typedef std::vector<Entry> EntryList;
+    typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterVector> AdjacentClusterMap;
+
+    /**
+     *  @brief  Get the key clusters to examine, in nested map or navigation map order, applying any restriction to modified components
+     *
+     *  @param  keyClusters to receive the key clusters
+     */
+    void GetKeyClusters(pandora::ClusterVector &keyClusters) const;
+
+    /**
+     *  @brief  Get the clusters in the connected components containing a cluster logged at or after the restriction log position
+     *
+     *  @param  componentClusters to receive the component clusters
+     */
+    void GetModifiedComponentClusters(ArenaClusterSet &componentClusters) const;
+
+    /**
+     *  @brief  Record a new navigation entry between a pair of clusters in the adjacency map
+     *
+     *  @param  pCluster1 address of the first cluster
+     *  @param  pCluster2 address of the second cluster
+     */
+    void AddAdjacentClusters(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2);
+
+    /**
+     *  @brief  Remove all navigation entries to and from a specified cluster from the adjacency map
+     *
+     *  @param  pCluster address of the cluster
+     */
+    void RemoveAdjacentClusters(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Get the dense index of a cluster in a given view, assigning a new index if required
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  clusterIndexMap the cluster index map for the view
+     *  @param  clusterVector the clusters in the view, ordered by index
+     *
+     *  @return the cluster index
+     */
+    static unsigned int GetOrAddClusterIndex(
+        const pandora::Cluster *const pCluster, ClusterIndexMap &clusterIndexMap, pandora::ClusterVector &clusterVector);
+
+    /**
+     *  @brief  Get the packed key for a specified trio of clusters
+     *
+     *  @param  pClusterU address of cluster u
+     *  @param  pClusterV address of cluster v
+     *  @param  pClusterW address of cluster w
+     *  @param  key to receive the packed key
+     *
+     *  @return whether all three clusters have been assigned indices
+     */
+    bool GetKey(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW,
+        std::uint64_t &key) const;
+
+    /**
+     *  @brief  Get the packed key for a specified trio of cluster indices
+     *
+     *  @param  indexU the u cluster index
+     *  @param  indexV the v cluster index
+     *  @param  indexW the w cluster index
+     *
+     *  @return the packed key
+     */
+    static std::uint64_t GetKey(const unsigned int indexU, const unsigned int indexV, const unsigned int indexW);
+
+    /**
+     *  @brief  Whether a coordinate list entry refers to a current overlap result
+     *
+     *  @param  entry the coordinate list entry
+     *
+     *  @return boolean
+     */
+    bool IsCurrentEntry(const Entry &entry) const;
 
-    TheTensor m_overlapTensor;                     ///< The overlap tensor
-    ClusterNavigationMap m_clusterNavigationMapUV; ///< The cluster navigation map U->V
-    ClusterNavigationMap m_clusterNavigationMapVW; ///< The cluster navigation map V->W
-    ClusterNavigationMap m_clusterNavigationMapWU; ///< The cluster navigation map W->U
+    /**
+     *  @brief  Find the overlap result for a specified trio of clusters
+     *
+     *  @param  pClusterU address of cluster u
+     *  @param  pClusterV address of cluster v
+     *  @param  pClusterW address of cluster w
+     *
+     *  @return the address of the overlap result, or nullptr if there is no such result
+     */
+    const OverlapResult *FindOverlapResult(
+        const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW) const;
+
+    /**
+     *  @brief  Remove the overlap results involving the specified cluster, logging the clusters of each removed result
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  hitType the hit type of the cluster
+     */
+    void RemoveOverlapResults(const pandora::Cluster *const pCluster, const pandora::HitType hitType);
+
+    /**
+     *  @brief  Remove the overlap result at a given result index
+     *
+     *  @param  resultIndex the result index
+     */
+    void RemoveOverlapResult(const unsigned int resultIndex);
+
+    /**
+     *  @brief  Remove coordinate list entries for overlap results that have since been removed, releasing their result indices, and sort
+     *          the coordinate list by key
+     */
+    void SortEntries() const;
+
+    /**
+     *  @brief  Get the nested map view of the overlap tensor, building it from the flat storage if required
+     *
+     *  @return the overlap tensor
+     */
+    const TheTensor &GetTensorView() const;
+
+    static const unsigned int m_nKeyBits;    ///< The number of bits for each view index in a packed key
+    static const std::uint64_t m_invalidKey; ///< The key marking unused result storage
+
+    bool m_useFlatStorage;                                 ///< Whether overlap results are held in flat storage, rather than nested maps
+    TheTensor m_overlapTensor;                             ///< The overlap tensor, if not using flat storage
+    ClusterIndexMap m_clusterIndexMapU;                    ///< The u cluster indices
+    ClusterIndexMap m_clusterIndexMapV;                    ///< The v cluster indices
+    ClusterIndexMap m_clusterIndexMapW;                    ///< The w cluster indices
+    pandora::ClusterVector m_clusterVectorU;               ///< The u clusters, ordered by index
+    pandora::ClusterVector m_clusterVectorV;               ///< The v clusters, ordered by index
+    pandora::ClusterVector m_clusterVectorW;               ///< The w clusters, ordered by index
+    ResultIndexMap m_resultIndexMap;                       ///< The result index for each packed key
+    std::deque<OverlapResult> m_overlapResults;            ///< The overlap result storage, keeping references valid as results are added
+    std::vector<std::uint64_t> m_resultKeys;               ///< The packed key for each result index, or the invalid key if unused
+    mutable std::vector<unsigned int> m_freeResultIndices; ///< The unused result indices
+    mutable EntryList m_entryList;                         ///< The coordinate list of packed keys and result indices
+    mutable bool m_isEntryListSorted;                      ///< Whether the coordinate list is sorted by key
+    mutable unsigned int m_nStaleEntries;                  ///< The number of coordinate list entries for removed overlap results
+    mutable TheTensor m_tensorView;                        ///< The nested map view of the flat storage
+    mutable bool m_isTensorViewValid;                      ///< Whether the nested map view of the flat storage is up to date
+    ClusterNavigationMap m_clusterNavigationMapUV;         ///< The cluster navigation map U->V
+    ClusterNavigationMap m_clusterNavigationMapVW;         ///< The cluster navigation map V->W
+    ClusterNavigationMap m_clusterNavigationMapWU;         ///< The cluster navigation map W->U
+
+    AdjacentClusterMap m_adjacentClusterMap;   ///< The clusters sharing a navigation entry, in either direction, with each cluster
+    pandora::ClusterVector m_modificationLog;  ///< The modified clusters, in order of modification
+    pandora::ClusterSet m_unavailableClusters; ///< The clusters recorded as unavailable
+    bool m_isRestricted;                       ///< Whether the key clusters are restricted to modified components
+    std::size_t m_restrictionLogPosition;      ///< The log position from which modified components are identified
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -313,10 +523,23 @@ inline void OverlapTensor<T>::GetConnectedElements(const pandora::Cluster *const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+inline OverlapTensor<T>::OverlapTensor() :
+    m_useFlatStorage(false),
+    m_isEntryListSorted(true),
+    m_nStaleEntries(0),
+    m_isTensorViewValid(true),
+    m_isRestricted(false),
+    m_restrictionLogPosition(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 inline typename OverlapTensor<T>::const_iterator OverlapTensor<T>::begin() const
 {
-    return m_overlapTensor.begin();
+    return this->GetTensorView().begin();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -324,7 +547,7 @@ inline typename OverlapTensor<T>::const_iterator OverlapTensor<T>::begin() const
 template <typename T>
 inline typename OverlapTensor<T>::const_iterator OverlapTensor<T>::end() const
 {
-    return m_overlapTensor.end();
+    return this->GetTensorView().end();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -333,13 +556,12 @@ template <typename T>
 inline const typename OverlapTensor<T>::OverlapResult &OverlapTensor<T>::GetOverlapResult(
     const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW) const
 {
-    const OverlapList &overlapList(this->GetOverlapList(pClusterU, pClusterV));
-    typename OverlapList::const_iterator iter = overlapList.find(pClusterW);
+    const OverlapResult *const pOverlapResult(this->FindOverlapResult(pClusterU, pClusterV, pClusterW));
 
-    if (overlapList.end() == iter)
+    if (!pOverlapResult)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
 
-    return iter->second;
+    return *pOverlapResult;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -362,9 +584,10 @@ inline const typename OverlapTensor<T>::OverlapList &OverlapTensor<T>::GetOverla
 template <typename T>
 inline const typename OverlapTensor<T>::OverlapMatrix &OverlapTensor<T>::GetOverlapMatrix(const pandora::Cluster *const pClusterU) const
 {
-    typename TheTensor::const_iterator iter = m_overlapTensor.find(pClusterU);
+    const TheTensor &overlapTensor(this->GetTensorView());
+    typename TheTensor::const_iterator iter = overlapTensor.find(pClusterU);
 
-    if (m_overlapTensor.end() == iter)
+    if (overlapTensor.end() == iter)
         throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
 
     return iter->second;
@@ -396,13 +619,59 @@ inline const typename OverlapTensor<T>::ClusterNavigationMap &OverlapTensor<T>::
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+inline std::size_t OverlapTensor<T>::GetModificationLogSize() const
+{
+    return m_modificationLog.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void OverlapTensor<T>::RestrictToModifiedComponents(const std::size_t logPosition)
+{
+    m_isRestricted = true;
+    m_restrictionLogPosition = logPosition;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void OverlapTensor<T>::ClearRestriction()
+{
+    m_isRestricted = false;
+    m_restrictionLogPosition = 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 inline void OverlapTensor<T>::Clear()
 {
     m_overlapTensor.clear();
+    m_clusterIndexMapU.clear();
+    m_clusterIndexMapV.clear();
+    m_clusterIndexMapW.clear();
+    m_clusterVectorU.clear();
+    m_clusterVectorV.clear();
+    m_clusterVectorW.clear();
+    m_resultIndexMap.clear();
+    m_overlapResults.clear();
+    m_resultKeys.clear();
+    m_freeResultIndices.clear();
+    m_entryList.clear();
+    m_isEntryListSorted = true;
+    m_nStaleEntries = 0;
+    m_tensorView.clear();
+    m_isTensorViewValid = true;
     m_clusterNavigationMapUV.clear();
     m_clusterNavigationMapVW.clear();
     m_clusterNavigationMapWU.clear();
+    m_adjacentClusterMap.clear();
+    m_modificationLog.clear();
+    m_unavailableClusters.clear();
+    m_isRestricted = false;
+    m_restrictionLogPosition = 0;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
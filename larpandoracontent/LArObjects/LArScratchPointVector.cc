@@ -0,0 +1,62 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArScratchPointVector.cc
+ *
+ *  @brief  Implementation of the lar scratch point vector class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArObjects/LArScratchPointVector.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+const std::size_t ScratchPointVector::m_maxRetainedCapacity = 1 << 14;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ScratchPointVector::ScratchPointVector() :
+    m_pool(ScratchPointVector::GetPool()),
+    m_pointVector((m_pool.m_nInUse < m_pool.m_pointVectors.size()) ? m_pool.m_pointVectors.at(m_pool.m_nInUse)
+                                                                     : m_pool.m_pointVectors.emplace_back())
+{
+    ++m_pool.m_nInUse;
+    m_pointVector.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ScratchPointVector::~ScratchPointVector()
+{
+    // ATTN Release the storage of unusually large vectors, so that one large cluster does not pin its memory for the lifetime of the thread
+    if (m_pointVector.capacity() > ScratchPointVector::m_maxRetainedCapacity)
+    {
+        CartesianPointVector().swap(m_pointVector);
+    }
+    else
+    {
+        m_pointVector.clear();
+    }
+
+    --m_pool.m_nInUse;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ScratchPointVector::Pool &ScratchPointVector::GetPool()
+{
+    thread_local Pool pool;
+    return pool;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ScratchPointVector::Pool::Pool() :
+    m_nInUse(0)
+{
+}
+
+} // namespace lar_content
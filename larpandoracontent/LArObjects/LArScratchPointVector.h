@@ -0,0 +1,86 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArScratchPointVector.h
+ *
+ *  @brief  Header file for the lar scratch point vector class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_SCRATCH_POINT_VECTOR_H
+#define LAR_SCRATCH_POINT_VECTOR_H 1
+
+#include "Objects/CartesianVector.h"
+
+#include "Pandora/PandoraInternal.h"
+
+#include <deque>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ScratchPointVector class, lending an empty cartesian point vector from a thread-local pool for the lifetime of the object.
+ *          The pooled vectors keep their capacity between uses, up to a fixed limit, so transient point vectors need not be reallocated
+ *          for each use. Nested scratch point vectors on the same thread receive distinct pooled vectors.
+ */
+class ScratchPointVector
+{
+public:
+    /**
+     *  @brief  Default constructor, borrowing a pooled vector
+     */
+    ScratchPointVector();
+
+    /**
+     *  @brief  Destructor, returning the pooled vector
+     */
+    ~ScratchPointVector();
+
+    ScratchPointVector(const ScratchPointVector &) = delete;
+    ScratchPointVector &operator=(const ScratchPointVector &) = delete;
+
+    /**
+     *  @brief  Get the borrowed point vector
+     *
+     *  @return the borrowed point vector
+     */
+    pandora::CartesianPointVector &Get();
+
+private:
+    /**
+     *  @brief  Pool class
+     */
+    class Pool
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        Pool();
+
+        std::deque<pandora::CartesianPointVector> m_pointVectors; ///< The pooled point vectors, with stable addresses
+        unsigned int m_nInUse;                                    ///< The number of pooled point vectors currently borrowed
+    };
+
+    /**
+     *  @brief  Get the pool for the current thread
+     *
+     *  @return the pool
+     */
+    static Pool &GetPool();
+
+    Pool &m_pool;                                ///< The pool for the current thread
+    pandora::CartesianPointVector &m_pointVector; ///< The borrowed point vector
+
+    static const std::size_t m_maxRetainedCapacity; ///< The largest capacity a pooled vector may retain when returned
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::CartesianPointVector &ScratchPointVector::Get()
+{
+    return m_pointVector;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_SCRATCH_POINT_VECTOR_H
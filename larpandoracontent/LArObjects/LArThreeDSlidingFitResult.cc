@@ -13,6 +13,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 
+#include "larpandoracontent/LArObjects/LArScratchPointVector.h"
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
 #include <algorithm>
@@ -206,7 +207,8 @@ void ThreeDSlidingFitResult::GetGlobalDirection(const float dTdL1, const float d
 
 TrackState ThreeDSlidingFitResult::GetPrimaryAxis(const Cluster *const pCluster, const float layerPitch)
 {
-    CartesianPointVector pointVector;
+    ScratchPointVector scratchPointVector;
+    CartesianPointVector &pointVector(scratchPointVector.Get());
     LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
     return ThreeDSlidingFitResult::GetPrimaryAxis(&pointVector, layerPitch);
 }
@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArHelpers/LArHitWidthHelper.h"
 #include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 
+#include "larpandoracontent/LArObjects/LArScratchPointVector.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 #include <algorithm>
@@ -32,7 +33,8 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const Cluster *const pCluster, const
     m_axisDirection(0.f, 0.f, 0.f),
     m_orthoDirection(0.f, 0.f, 0.f)
 {
-    CartesianPointVector pointVector;
+    ScratchPointVector scratchPointVector;
+    CartesianPointVector &pointVector(scratchPointVector.Get());
     LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
 
     this->CalculateAxes(pointVector, layerPitch);
@@ -48,7 +50,10 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const Cluster *const pCluster, const
     {
         // TODO Refactor hit splitting and ensure all parameters configurable
         LArHitWidthHelper::ConstituentHitVector constituentHitVector(LArHitWidthHelper::GetConstituentHits(pCluster, 0.5f, 1.f, true));
-        const CartesianPointVector constituentHitPointVector(LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitVector));
+        ScratchPointVector constituentScratchPointVector;
+        CartesianPointVector &constituentHitPointVector(constituentScratchPointVector.Get());
+        LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitVector, constituentHitPointVector);
+
         this->FillLayerFitContributionMap(constituentHitPointVector);
     }
 
@@ -90,7 +95,8 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const Cluster *const pCluster, const
 
     if (std::fabs(cosOpeningAngle) < axisDeviationLimitForHitDivision)
     {
-        CartesianPointVector pointVector;
+        ScratchPointVector scratchPointVector;
+        CartesianPointVector &pointVector(scratchPointVector.Get());
         LArClusterHelper::GetCoordinateVector(pCluster, pointVector);
         this->FillLayerFitContributionMap(pointVector);
     }
@@ -98,7 +104,10 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const Cluster *const pCluster, const
     {
         // TODO Refactor hit splitting and ensure all parameters configurable
         LArHitWidthHelper::ConstituentHitVector constituentHitVector(LArHitWidthHelper::GetConstituentHits(pCluster, 0.5f, 1.f, true));
-        const CartesianPointVector constituentHitPointVector(LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitVector));
+        ScratchPointVector constituentScratchPointVector;
+        CartesianPointVector &constituentHitPointVector(constituentScratchPointVector.Get());
+        LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitVector, constituentHitPointVector);
+
         this->FillLayerFitContributionMap(constituentHitPointVector);
     }
 
@@ -17,6 +17,7 @@
 #include "larpandoracontent/LArPersistency/EventReadingAlgorithm.h"
 
 #include <algorithm>
+#include <future>
 
 using namespace pandora;
 
@@ -29,7 +30,8 @@ EventReadingAlgorithm::EventReadingAlgorithm() :
     m_larCaloHitVersion(1),
     m_useLArMCParticles(true),
     m_larMCParticleVersion(2),
-    m_pEventFileReader(nullptr)
+    m_pEventFileReader(nullptr),
+    m_nReadAheadFiles(0)
 {
 }
 
@@ -37,6 +39,18 @@ EventReadingAlgorithm::EventReadingAlgorithm() :
 
 EventReadingAlgorithm::~EventReadingAlgorithm()
 {
+    for (StagedFileReader &stagedFileReader : m_stagedFileReaderList)
+    {
+        try
+        {
+            delete stagedFileReader.second.get();
+        }
+        catch (...)
+        {
+            // ATTN The background open may have thrown any exception type, none of which may escape the destructor
+        }
+    }
+
     delete m_pEventFileReader;
 }
 
@@ -68,6 +82,7 @@ StatusCode EventReadingAlgorithm::Initialize()
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReplaceEventFileReader(m_eventFileName));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_pEventFileReader->GoToEvent(m_skipToEvent));
+        this->StageEventFileReaders();
     }
 
     return STATUS_CODE_SUCCESS;
@@ -98,12 +113,21 @@ StatusCode EventReadingAlgorithm::Run()
 
 void EventReadingAlgorithm::MoveToNextEventFile()
 {
-    if (m_eventFileNameVector.empty())
+    if (m_stagedFileReaderList.empty() && m_eventFileNameVector.empty())
         throw StopProcessingException("All event files processed");
 
-    m_eventFileName = m_eventFileNameVector.back();
-    m_eventFileNameVector.pop_back();
+    if (!m_stagedFileReaderList.empty())
+    {
+        m_eventFileName = m_stagedFileReaderList.front().first;
+    }
+    else
+    {
+        m_eventFileName = m_eventFileNameVector.back();
+        m_eventFileNameVector.pop_back();
+    }
+
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ReplaceEventFileReader(m_eventFileName));
+    this->StageEventFileReaders();
 
     try
     {
@@ -123,28 +147,66 @@ StatusCode EventReadingAlgorithm::ReplaceEventFileReader(const std::string &file
     m_pEventFileReader = nullptr;
 
     std::cout << "EventReadingAlgorithm: Processing event file: " << fileName << std::endl;
+
+    // ATTN A reader staged in the background is handed over as-is; the file has already been opened (and, for xml, parsed)
+    if (!m_stagedFileReaderList.empty() && (fileName == m_stagedFileReaderList.front().first))
+    {
+        StagedFileReader stagedFileReader(std::move(m_stagedFileReaderList.front()));
+        m_stagedFileReaderList.pop_front();
+        m_pEventFileReader = stagedFileReader.second.get();
+    }
+    else
+    {
+        m_pEventFileReader = this->CreateEventFileReader(fileName);
+    }
+
+    if (!m_pEventFileReader)
+        return STATUS_CODE_FAILURE;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+FileReader *EventReadingAlgorithm::CreateEventFileReader(const std::string &fileName) const
+{
+    FileReader *pFileReader(nullptr);
     const FileType eventFileType(this->GetFileType(fileName));
 
     if (BINARY == eventFileType)
     {
-        m_pEventFileReader = new BinaryFileReader(this->GetPandora(), fileName);
+        pFileReader = new BinaryFileReader(this->GetPandora(), fileName);
     }
     else if (XML == eventFileType)
     {
-        m_pEventFileReader = new XmlFileReader(this->GetPandora(), fileName);
+        pFileReader = new XmlFileReader(this->GetPandora(), fileName);
     }
     else
     {
-        return STATUS_CODE_FAILURE;
+        return nullptr;
     }
 
     if (m_useLArCaloHits)
-        m_pEventFileReader->SetFactory(new LArCaloHitFactory(m_larCaloHitVersion));
+        pFileReader->SetFactory(new LArCaloHitFactory(m_larCaloHitVersion));
 
     if (m_useLArMCParticles)
-        m_pEventFileReader->SetFactory(new LArMCParticleFactory(m_larMCParticleVersion));
+        pFileReader->SetFactory(new LArMCParticleFactory(m_larMCParticleVersion));
 
-    return STATUS_CODE_SUCCESS;
+    return pFileReader;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::StageEventFileReaders()
+{
+    while ((m_stagedFileReaderList.size() < m_nReadAheadFiles) && !m_eventFileNameVector.empty())
+    {
+        const std::string fileName(m_eventFileNameVector.back());
+        m_eventFileNameVector.pop_back();
+
+        m_stagedFileReaderList.emplace_back(
+            fileName, std::async(std::launch::async, &EventReadingAlgorithm::CreateEventFileReader, this, fileName));
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -236,6 +298,9 @@ StatusCode EventReadingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseLArMCParticles", m_useLArMCParticles));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ReadAheadFiles", m_nReadAheadFiles));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -14,6 +14,11 @@
 
 #include "Persistency/PandoraIO.h"
 
+#include <deque>
+#include <future>
+#include <string>
+#include <utility>
+
 namespace pandora
 {
 class FileReader;
@@ -52,6 +57,9 @@ public:
     };
 
 private:
+    typedef std::pair<std::string, std::future<pandora::FileReader *>> StagedFileReader;
+    typedef std::deque<StagedFileReader> StagedFileReaderList;
+
     pandora::StatusCode Initialize();
     pandora::StatusCode Run();
 
@@ -67,6 +75,21 @@ private:
      */
     pandora::StatusCode ReplaceEventFileReader(const std::string &fileName);
 
+    /**
+     *  @brief  Create and configure a new event file reader for the specified file. Touches no pandora event state, so may be called
+     *          from a background thread.
+     *
+     *  @param  fileName the file name
+     *
+     *  @return the address of the new file reader, or nullptr if the file type is not supported
+     */
+    pandora::FileReader *CreateEventFileReader(const std::string &fileName) const;
+
+    /**
+     *  @brief  Start opening upcoming event files in the background, until the configured number of read-ahead files are staged
+     */
+    void StageEventFileReaders();
+
     /**
      *  @brief  Analyze a provided file name to extract the file type/extension
      *
@@ -89,6 +112,9 @@ private:
     unsigned int m_larMCParticleVersion; ///< LArMCParticle version for LArMCParticleFactory
 
     pandora::FileReader *m_pEventFileReader; ///< Address of the event file reader
+
+    unsigned int m_nReadAheadFiles;              ///< The number of upcoming event files to open in the background (zero to disable)
+    StagedFileReaderList m_stagedFileReaderList; ///< The upcoming event file names and their readers, in processing order
 };
 
 } // namespace lar_content
@@ -368,33 +368,35 @@ void TwoViewDeltaRayMatchingAlgorithm::UpdateForThirdViewClusterModification(con
 {
     auto &theMatrix(this->GetMatchingControl().GetOverlapMatrix());
 
-    for (auto [pCluster1, overlapList] : theMatrix)
+    MatrixType::ElementList elementList;
+    theMatrix.GetAllElements(false, elementList);
+
+    for (const MatrixType::Element &element : elementList)
     {
-        for (auto [pCluster2, overlapResult] : overlapList)
-        {
-            ClusterList matchedClusters(overlapResult.GetMatchedClusterList());
+        const Cluster *const pCluster1(element.GetCluster1()), *const pCluster2(element.GetCluster2());
+        const TwoViewDeltaRayOverlapResult &overlapResult(element.GetOverlapResult());
+        ClusterList matchedClusters(overlapResult.GetMatchedClusterList());
 
-            auto matchedClustersIter(std::find(matchedClusters.begin(), matchedClusters.end(), pModifiedCluster));
+        auto matchedClustersIter(std::find(matchedClusters.begin(), matchedClusters.end(), pModifiedCluster));
 
-            if (matchedClustersIter == matchedClusters.end())
-                continue;
+        if (matchedClustersIter == matchedClusters.end())
+            continue;
 
-            float tempReducedChiSquared(std::numeric_limits<float>::max());
+        float tempReducedChiSquared(std::numeric_limits<float>::max());
 
-            if (isMuon)
-                this->PerformThreeViewMatching(pCluster1, pCluster2, pModifiedCluster, tempReducedChiSquared);
+        if (isMuon)
+            this->PerformThreeViewMatching(pCluster1, pCluster2, pModifiedCluster, tempReducedChiSquared);
 
-            if (tempReducedChiSquared > m_maxGoodMatchReducedChiSquared)
-                matchedClusters.erase(matchedClustersIter);
+        if (tempReducedChiSquared > m_maxGoodMatchReducedChiSquared)
+            matchedClusters.erase(matchedClustersIter);
 
-            float reducedChiSquared(std::numeric_limits<float>::max());
-            const Cluster *const pBestMatchedCluster =
-                this->GetBestMatchedCluster(pCluster1, pCluster2, overlapResult.GetCommonMuonPfoList(), matchedClusters, reducedChiSquared);
+        float reducedChiSquared(std::numeric_limits<float>::max());
+        const Cluster *const pBestMatchedCluster =
+            this->GetBestMatchedCluster(pCluster1, pCluster2, overlapResult.GetCommonMuonPfoList(), matchedClusters, reducedChiSquared);
 
-            TwoViewDeltaRayOverlapResult newOverlapResult(
-                overlapResult.GetXOverlap(), overlapResult.GetCommonMuonPfoList(), pBestMatchedCluster, matchedClusters, reducedChiSquared);
-            theMatrix.ReplaceOverlapResult(pCluster1, pCluster2, newOverlapResult);
-        }
+        TwoViewDeltaRayOverlapResult newOverlapResult(
+            overlapResult.GetXOverlap(), overlapResult.GetCommonMuonPfoList(), pBestMatchedCluster, matchedClusters, reducedChiSquared);
+        theMatrix.ReplaceOverlapResult(pCluster1, pCluster2, newOverlapResult);
     }
 }
 
@@ -15,7 +15,7 @@ using namespace pandora;
 namespace lar_content
 {
 
-ClearLongitudinalTracksTool::ClearLongitudinalTracksTool() : m_minMatchedFraction(0.8f)
+ClearLongitudinalTracksTool::ClearLongitudinalTracksTool() : LongitudinalTensorTool(true), m_minMatchedFraction(0.8f)
 {
 }
 
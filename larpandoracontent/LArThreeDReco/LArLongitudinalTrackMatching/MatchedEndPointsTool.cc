@@ -15,7 +15,7 @@ using namespace pandora;
 namespace lar_content
 {
 
-MatchedEndPointsTool::MatchedEndPointsTool() : m_minMatchedFraction(0.8f), m_maxEndPointChi2(3.f)
+MatchedEndPointsTool::MatchedEndPointsTool() : LongitudinalTensorTool(true), m_minMatchedFraction(0.8f), m_maxEndPointChi2(3.f)
 {
 }
 
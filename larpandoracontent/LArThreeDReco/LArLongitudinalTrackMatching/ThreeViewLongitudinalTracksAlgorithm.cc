@@ -13,6 +13,8 @@
 
 #include "larpandoracontent/LArThreeDReco/LArLongitudinalTrackMatching/ThreeViewLongitudinalTracksAlgorithm.h"
 
+#include <limits>
+
 using namespace pandora;
 
 namespace lar_content
@@ -200,22 +202,7 @@ void ThreeViewLongitudinalTracksAlgorithm::CalculateOverlapResult(const TwoDSlid
 
 void ThreeViewLongitudinalTracksAlgorithm::ExamineOverlapContainer()
 {
-    unsigned int repeatCounter(0);
-
-    for (TensorToolVector::const_iterator iter = m_algorithmToolVector.begin(), iterEnd = m_algorithmToolVector.end(); iter != iterEnd;)
-    {
-        if ((*iter)->Run(this, this->GetMatchingControl().GetOverlapTensor()))
-        {
-            iter = m_algorithmToolVector.begin();
-
-            if (++repeatCounter > m_nMaxTensorToolRepeats)
-                break;
-        }
-        else
-        {
-            ++iter;
-        }
-    }
+    this->RunTensorTools(this, m_algorithmToolVector, m_nMaxTensorToolRepeats);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
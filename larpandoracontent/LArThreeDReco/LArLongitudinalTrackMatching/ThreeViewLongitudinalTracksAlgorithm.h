@@ -15,6 +15,7 @@
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewTrackMatchingAlgorithm.h"
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/ThreeViewMatchingControl.h"
+#include "larpandoracontent/LArThreeDReco/LArThreeDBase/TensorTool.h"
 
 namespace lar_content
 {
@@ -82,12 +83,19 @@ private:
 /**
  *  @brief  LongitudinalTensorTool class
  */
-class LongitudinalTensorTool : public pandora::AlgorithmTool
+class LongitudinalTensorTool : public TensorTool
 {
 public:
     typedef ThreeViewLongitudinalTracksAlgorithm::MatchingType::TensorType TensorType;
     typedef std::vector<TensorType::ElementList::const_iterator> IteratorList;
 
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  isComponentLocal whether the tool is component local
+     */
+    LongitudinalTensorTool(const bool isComponentLocal = false);
+
     /**
      *  @brief  Run the algorithm tool
      *
@@ -99,6 +107,12 @@ public:
     virtual bool Run(ThreeViewLongitudinalTracksAlgorithm *const pAlgorithm, TensorType &overlapTensor) = 0;
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LongitudinalTensorTool::LongitudinalTensorTool(const bool isComponentLocal) : TensorTool(isComponentLocal)
+{
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_THREE_VIEW_LONGITUDINAL_TRACKS_ALGORITHM_H
@@ -16,6 +16,7 @@ namespace lar_content
 {
 
 ClearShowersTool::ClearShowersTool() :
+    ShowerTensorTool(true),
     m_minMatchedFraction(0.2f),
     m_minMatchedSamplingPoints(40),
     m_minXOverlapFraction(0.5f),
@@ -22,6 +22,7 @@ namespace lar_content
 {
 
 SplitShowersTool::SplitShowersTool() :
+    ShowerTensorTool(true),
     m_nCommonClusters(2),
     m_minMatchedFraction(0.25f),
     m_minMatchedSamplingPoints(40),
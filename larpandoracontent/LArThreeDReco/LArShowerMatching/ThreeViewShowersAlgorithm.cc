@@ -13,6 +13,8 @@
 
 #include "larpandoracontent/LArThreeDReco/LArShowerMatching/ThreeViewShowersAlgorithm.h"
 
+#include <limits>
+
 using namespace pandora;
 
 namespace lar_content
@@ -304,22 +306,7 @@ void ThreeViewShowersAlgorithm::GetBestHitOverlapFraction(const Cluster *const p
 
 void ThreeViewShowersAlgorithm::ExamineOverlapContainer()
 {
-    unsigned int repeatCounter(0);
-
-    for (TensorToolVector::const_iterator iter = m_algorithmToolVector.begin(), iterEnd = m_algorithmToolVector.end(); iter != iterEnd;)
-    {
-        if ((*iter)->Run(this, this->GetMatchingControl().GetOverlapTensor()))
-        {
-            iter = m_algorithmToolVector.begin();
-
-            if (++repeatCounter > m_nMaxTensorToolRepeats)
-                break;
-        }
-        else
-        {
-            ++iter;
-        }
-    }
+    this->RunTensorTools(this, m_algorithmToolVector, m_nMaxTensorToolRepeats);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -15,6 +15,7 @@
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewMatchingAlgorithm.h"
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/ThreeViewMatchingControl.h"
+#include "larpandoracontent/LArThreeDReco/LArThreeDBase/TensorTool.h"
 
 namespace lar_content
 {
@@ -167,12 +168,19 @@ private:
 /**
  *  @brief  ShowerTensorTool class
  */
-class ShowerTensorTool : public pandora::AlgorithmTool
+class ShowerTensorTool : public TensorTool
 {
 public:
     typedef ThreeViewShowersAlgorithm::MatchingType::TensorType TensorType;
     typedef std::vector<TensorType::ElementList::const_iterator> IteratorList;
 
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  isComponentLocal whether the tool is component local
+     */
+    ShowerTensorTool(const bool isComponentLocal = false);
+
     /**
      *  @brief  Run the algorithm tool
      *
@@ -184,6 +192,12 @@ public:
     virtual bool Run(ThreeViewShowersAlgorithm *const pAlgorithm, TensorType &overlapTensor) = 0;
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline ShowerTensorTool::ShowerTensorTool(const bool isComponentLocal) : TensorTool(isComponentLocal)
+{
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_THREE_VIEW_SHOWERS_ALGORITHM_H
@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 
+#include "larpandoracontent/LArObjects/LArEventArena.h"
 #include "larpandoracontent/LArObjects/LArShowerOverlapResult.h"
 #include "larpandoracontent/LArObjects/LArTrackOverlapResult.h"
 #include "larpandoracontent/LArObjects/LArTrackTwoViewOverlapResult.h"
@@ -24,7 +25,11 @@ namespace lar_content
 {
 
 template <typename T>
-NViewMatchingAlgorithm<T>::NViewMatchingAlgorithm() : m_matchingControl(this)
+NViewMatchingAlgorithm<T>::NViewMatchingAlgorithm() :
+    m_matchingControl(this),
+    m_incrementalToolScheduling(false),
+    m_checkToolScheduling(false),
+    m_printToolRunCounters(false)
 {
 }
 
@@ -53,6 +58,19 @@ void NViewMatchingAlgorithm<T>::UpdateUponDeletion(const Cluster *const pDeleted
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+bool NViewMatchingAlgorithm<T>::CreateThreeDParticles(const ProtoParticleVector &protoParticleVector)
+{
+    const bool particlesMade(MatchingBaseAlgorithm::CreateThreeDParticles(protoParticleVector));
+
+    for (const ProtoParticle &protoParticle : protoParticleVector)
+        m_matchingControl.UpdateForAvailabilityChanges(protoParticle.m_clusterList);
+
+    return particlesMade;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 const std::string &NViewMatchingAlgorithm<T>::GetClusterListName(const HitType hitType) const
 {
@@ -109,11 +127,39 @@ void NViewMatchingAlgorithm<T>::PerformMainLoop()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void NViewMatchingAlgorithm<T>::PrintToolRunCounters(const ToolRunCounters &toolRunCounters) const
+{
+    std::cout << this->GetType() << ": tool runs " << toolRunCounters.m_nToolRuns << ", restricted " << toolRunCounters.m_nRestrictedToolRuns
+              << ", skipped " << toolRunCounters.m_nSkippedToolRuns << ", changing " << toolRunCounters.m_nChangingToolRuns << ", checked "
+              << toolRunCounters.m_nCheckedToolRuns << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+StatusCode NViewMatchingAlgorithm<T>::Reset()
+{
+    EventArena::CheckLiveAllocations(this->GetInstanceName());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 StatusCode NViewMatchingAlgorithm<T>::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_matchingControl.ReadSettings(xmlHandle));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "IncrementalToolScheduling", m_incrementalToolScheduling));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "CheckToolScheduling", m_checkToolScheduling));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "PrintToolRunCounters", m_printToolRunCounters));
+
     return MatchingBaseAlgorithm::ReadSettings(xmlHandle);
 }
 
@@ -10,6 +10,11 @@
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/MatchingBaseAlgorithm.h"
 
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -38,19 +43,72 @@ public:
     const pandora::ClusterList &GetInputClusterList(const pandora::HitType hitType) const;
     const pandora::ClusterList &GetSelectedClusterList(const pandora::HitType hitType) const;
 
+    /**
+     *  @brief  Create particles using findings from recent algorithm processing, then update the matching control to reflect the resulting
+     *          changes in cluster availability
+     *
+     *  @param  protoParticleVector the proto particle vector
+     *
+     *  @return whether particles were created
+     */
+    virtual bool CreateThreeDParticles(const ProtoParticleVector &protoParticleVector);
+
 protected:
+    /**
+     *  @brief  ToolRunCounters class, counting the tensor tool runs made by RunTensorTools
+     */
+    class ToolRunCounters
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        ToolRunCounters();
+
+        unsigned int m_nToolRuns;           ///< The number of tool runs
+        unsigned int m_nRestrictedToolRuns; ///< The number of tool runs restricted to the components modified since the last run
+        unsigned int m_nSkippedToolRuns;    ///< The number of tool runs skipped, as nothing had been modified since the last run
+        unsigned int m_nChangingToolRuns;   ///< The number of tool runs reporting changes
+        unsigned int m_nCheckedToolRuns;    ///< The number of unrestricted tool runs made to check restricted or skipped tool runs
+    };
+
     /**
      *  @brief  Get the matching control
      */
     MatchingType &GetMatchingControl();
 
+    /**
+     *  @brief  Run tensor tools on the overlap tensor in turn, returning to the first tool whenever a tool makes changes. With incremental
+     *          scheduling, a component local tool is restricted to the components modified since its last run, and not rerun if nothing
+     *          has been modified. Changes in cluster availability must have been recorded by the matching control.
+     *
+     *  @param  pAlgorithm address of the algorithm running the tools
+     *  @param  toolVector the tensor tools
+     *  @param  nMaxRepeats the maximum number of returns to the first tool
+     */
+    template <typename TAlgorithm, typename TTool>
+    void RunTensorTools(TAlgorithm *const pAlgorithm, const std::vector<TTool *> &toolVector, const unsigned int nMaxRepeats);
+
+    /**
+     *  @brief  Print the tensor tool run counts
+     *
+     *  @param  toolRunCounters the tool run counters
+     */
+    void PrintToolRunCounters(const ToolRunCounters &toolRunCounters) const;
+
     virtual void SelectAllInputClusters();
     virtual void PrepareAllInputClusters();
     virtual void PerformMainLoop();
     virtual void TidyUp();
+    virtual pandora::StatusCode Reset();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     MatchingType m_matchingControl; ///< The matching control
+
+private:
+    bool m_incrementalToolScheduling; ///< Whether to rerun component local tensor tools on the components modified since their last run only
+    bool m_checkToolScheduling;       ///< Whether to check that unrestricted runs of restricted or skipped tensor tools would make no changes
+    bool m_printToolRunCounters;      ///< Whether to print the tensor tool run counts after running the tensor tools
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -61,6 +119,102 @@ inline T &NViewMatchingAlgorithm<T>::GetMatchingControl()
     return m_matchingControl;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+template <typename TAlgorithm, typename TTool>
+inline void NViewMatchingAlgorithm<T>::RunTensorTools(
+    TAlgorithm *const pAlgorithm, const std::vector<TTool *> &toolVector, const unsigned int nMaxRepeats)
+{
+    typename MatchingType::TensorType &overlapTensor(m_matchingControl.GetOverlapTensor());
+    ToolRunCounters toolRunCounters;
+    unsigned int repeatCounter(0);
+
+    // ATTN The tensor modification log size at the start of the last run of each tool, if that tool is to be scheduled incrementally
+    const std::size_t notYetRun(std::numeric_limits<std::size_t>::max());
+    std::vector<std::size_t> lastRunLogSizes(toolVector.size(), notYetRun);
+
+    for (unsigned int toolIndex = 0; toolIndex < toolVector.size();)
+    {
+        TTool *const pTool(toolVector.at(toolIndex));
+        bool changesMade(false);
+
+        if (!m_incrementalToolScheduling || !pTool->IsComponentLocal())
+        {
+            changesMade = pTool->Run(pAlgorithm, overlapTensor);
+            ++toolRunCounters.m_nToolRuns;
+        }
+        else
+        {
+            // ATTN A component local tool need only re-examine the tensor components modified since its last run, as it could make no
+            // changes to the others then and they are unchanged. If nothing has been modified, the tool is not rerun at all.
+            const std::size_t logSize(overlapTensor.GetModificationLogSize());
+            const std::size_t lastRunLogSize(lastRunLogSizes.at(toolIndex));
+            lastRunLogSizes.at(toolIndex) = logSize;
+
+            if (notYetRun == lastRunLogSize)
+            {
+                changesMade = pTool->Run(pAlgorithm, overlapTensor);
+                ++toolRunCounters.m_nToolRuns;
+            }
+            else if (logSize > lastRunLogSize)
+            {
+                overlapTensor.RestrictToModifiedComponents(lastRunLogSize);
+                changesMade = pTool->Run(pAlgorithm, overlapTensor);
+                overlapTensor.ClearRestriction();
+                ++toolRunCounters.m_nToolRuns;
+                ++toolRunCounters.m_nRestrictedToolRuns;
+            }
+            else
+            {
+                ++toolRunCounters.m_nSkippedToolRuns;
+            }
+
+            // ATTN An unrestricted run must then make no changes either, as the tool would otherwise have been wrongly declared component local
+            if (m_checkToolScheduling && !changesMade && (notYetRun != lastRunLogSize))
+            {
+                ++toolRunCounters.m_nCheckedToolRuns;
+
+                if (pTool->Run(pAlgorithm, overlapTensor))
+                {
+                    std::cout << "NViewMatchingAlgorithm: unrestricted run of tool " << pTool->GetInstanceName()
+                              << " made changes that its restricted or skipped run did not" << std::endl;
+                    throw pandora::StatusCodeException(pandora::STATUS_CODE_FAILURE);
+                }
+            }
+        }
+
+        if (changesMade)
+        {
+            ++toolRunCounters.m_nChangingToolRuns;
+            toolIndex = 0;
+
+            if (++repeatCounter > nMaxRepeats)
+                break;
+        }
+        else
+        {
+            ++toolIndex;
+        }
+    }
+
+    if (m_printToolRunCounters)
+        this->PrintToolRunCounters(toolRunCounters);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline NViewMatchingAlgorithm<T>::ToolRunCounters::ToolRunCounters() :
+    m_nToolRuns(0),
+    m_nRestrictedToolRuns(0),
+    m_nSkippedToolRuns(0),
+    m_nChangingToolRuns(0),
+    m_nCheckedToolRuns(0)
+{
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_N_VIEW_MATCHING_ALGORITHM_H
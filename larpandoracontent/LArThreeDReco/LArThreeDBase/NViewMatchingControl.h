@@ -48,6 +48,13 @@ protected:
      */
     virtual void UpdateUponDeletion(const pandora::Cluster *const pDeletedCluster) = 0;
 
+    /**
+     *  @brief  Update to reflect possible changes in the availability of a list of clusters, e.g. following particle creation
+     *
+     *  @param  clusterList the list of clusters
+     */
+    virtual void UpdateForAvailabilityChanges(const pandora::ClusterList &clusterList) = 0;
+
     /**
      *  @brief  Get the cluster list name corresponding to a specified hit type
      *
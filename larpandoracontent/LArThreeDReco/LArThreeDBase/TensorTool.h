@@ -0,0 +1,57 @@
+/**
+ *  @file   larpandoracontent/LArThreeDReco/LArThreeDBase/TensorTool.h
+ *
+ *  @brief  Header file for the tensor tool class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_TENSOR_TOOL_H
+#define LAR_TENSOR_TOOL_H 1
+
+#include "Pandora/AlgorithmTool.h"
+
+namespace lar_content
+{
+
+/**
+ *  @brief  TensorTool class, the base for tools run on an overlap tensor by NViewMatchingAlgorithm::RunTensorTools
+ */
+class TensorTool : public pandora::AlgorithmTool
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  isComponentLocal whether the tool is component local
+     */
+    TensorTool(const bool isComponentLocal);
+
+    /**
+     *  @brief  Whether the tool is component local: it examines the overlap tensor only via the (sorted) key clusters, unambiguous elements
+     *          and elements connected to key clusters, depends on no event state outside the tensor that the calling algorithm may change,
+     *          other than the content of tensor clusters, and makes changes only once it has finished examining the tensor
+     *
+     *  @return boolean
+     */
+    bool IsComponentLocal() const;
+
+private:
+    const bool m_isComponentLocal; ///< Whether the tool is component local
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline TensorTool::TensorTool(const bool isComponentLocal) : m_isComponentLocal(isComponentLocal)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool TensorTool::IsComponentLocal() const
+{
+    return m_isComponentLocal;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_TENSOR_TOOL_H
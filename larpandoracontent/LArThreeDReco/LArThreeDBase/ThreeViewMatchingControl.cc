@@ -113,6 +113,14 @@ void ThreeViewMatchingControl<T>::UpdateUponDeletion(const Cluster *const pDelet
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void ThreeViewMatchingControl<T>::UpdateForAvailabilityChanges(const ClusterList &clusterList)
+{
+    m_overlapTensor.RecordAvailabilityChanges(clusterList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 const std::string &ThreeViewMatchingControl<T>::GetClusterListName(const HitType hitType) const
 {
@@ -244,6 +252,11 @@ StatusCode ThreeViewMatchingControl<T>::ReadSettings(const TiXmlHandle xmlHandle
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameV", m_inputClusterListNameV));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameW", m_inputClusterListNameW));
 
+    bool useFlatOverlapStorage(false);
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseFlatOverlapStorage", useFlatOverlapStorage));
+    m_overlapTensor.SetUseFlatStorage(useFlatOverlapStorage);
+
     return STATUS_CODE_SUCCESS;
 }
 
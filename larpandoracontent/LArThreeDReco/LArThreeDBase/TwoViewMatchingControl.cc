@@ -111,6 +111,14 @@ void TwoViewMatchingControl<T>::UpdateUponDeletion(const Cluster *const pDeleted
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void TwoViewMatchingControl<T>::UpdateForAvailabilityChanges(const ClusterList &)
+{
+    // ATTN The overlap matrix does not log modifications, so has no record of cluster availability to update
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 const std::string &TwoViewMatchingControl<T>::GetClusterListName(const HitType hitType) const
 {
@@ -234,6 +242,11 @@ StatusCode TwoViewMatchingControl<T>::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListName1", m_inputClusterListName1));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListName2", m_inputClusterListName2));
 
+    bool useFlatOverlapStorage(false);
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseFlatOverlapStorage", useFlatOverlapStorage));
+    m_overlapMatrix.SetUseFlatStorage(useFlatOverlapStorage);
+
     return STATUS_CODE_SUCCESS;
 }
 
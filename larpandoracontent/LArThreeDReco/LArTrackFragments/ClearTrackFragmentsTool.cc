@@ -365,36 +365,33 @@ void ClearTrackFragmentsTool::RebuildClusters(
 void ClearTrackFragmentsTool::GetAffectedKeyClusters(
     const TensorType &overlapTensor, const ClusterList &clustersToRemoveFromTensor, ClusterList &affectedKeyClusters) const
 {
-    for (TensorType::const_iterator tIterU = overlapTensor.begin(), tIterUEnd = overlapTensor.end(); tIterU != tIterUEnd; ++tIterU)
+    TensorType::ElementList elementList;
+    overlapTensor.GetAllElements(false, elementList);
+
+    for (const TensorType::Element &element : elementList)
     {
-        for (TensorType::OverlapMatrix::const_iterator tIterV = tIterU->second.begin(), tIterVEnd = tIterU->second.end(); tIterV != tIterVEnd; ++tIterV)
-        {
-            for (TensorType::OverlapList::const_iterator tIterW = tIterV->second.begin(), tIterWEnd = tIterV->second.end(); tIterW != tIterWEnd; ++tIterW)
-            {
-                const TensorType::OverlapResult &overlapResult(tIterW->second);
-                const HitType fragmentHitType(overlapResult.GetFragmentHitType());
-                const ClusterList &fragmentClusters(overlapResult.GetFragmentClusterList());
+        const TensorType::OverlapResult &overlapResult(element.GetOverlapResult());
+        const HitType fragmentHitType(overlapResult.GetFragmentHitType());
+        const ClusterList &fragmentClusters(overlapResult.GetFragmentClusterList());
 
-                for (ClusterList::const_iterator fIter = fragmentClusters.begin(), fIterEnd = fragmentClusters.end(); fIter != fIterEnd; ++fIter)
-                {
-                    if (clustersToRemoveFromTensor.end() == std::find(clustersToRemoveFromTensor.begin(), clustersToRemoveFromTensor.end(), *fIter))
-                        continue;
+        for (ClusterList::const_iterator fIter = fragmentClusters.begin(), fIterEnd = fragmentClusters.end(); fIter != fIterEnd; ++fIter)
+        {
+            if (clustersToRemoveFromTensor.end() == std::find(clustersToRemoveFromTensor.begin(), clustersToRemoveFromTensor.end(), *fIter))
+                continue;
 
-                    if ((TPC_VIEW_U != fragmentHitType) &&
-                        (affectedKeyClusters.end() == std::find(affectedKeyClusters.begin(), affectedKeyClusters.end(), tIterU->first)))
-                        affectedKeyClusters.push_back(tIterU->first);
+            if ((TPC_VIEW_U != fragmentHitType) &&
+                (affectedKeyClusters.end() == std::find(affectedKeyClusters.begin(), affectedKeyClusters.end(), element.GetClusterU())))
+                affectedKeyClusters.push_back(element.GetClusterU());
 
-                    if ((TPC_VIEW_V != fragmentHitType) &&
-                        (affectedKeyClusters.end() == std::find(affectedKeyClusters.begin(), affectedKeyClusters.end(), tIterV->first)))
-                        affectedKeyClusters.push_back(tIterV->first);
+            if ((TPC_VIEW_V != fragmentHitType) &&
+                (affectedKeyClusters.end() == std::find(affectedKeyClusters.begin(), affectedKeyClusters.end(), element.GetClusterV())))
+                affectedKeyClusters.push_back(element.GetClusterV());
 
-                    if ((TPC_VIEW_W != fragmentHitType) &&
-                        (affectedKeyClusters.end() == std::find(affectedKeyClusters.begin(), affectedKeyClusters.end(), tIterW->first)))
-                        affectedKeyClusters.push_back(tIterW->first);
+            if ((TPC_VIEW_W != fragmentHitType) &&
+                (affectedKeyClusters.end() == std::find(affectedKeyClusters.begin(), affectedKeyClusters.end(), element.GetClusterW())))
+                affectedKeyClusters.push_back(element.GetClusterW());
 
-                    break;
-                }
-            }
+            break;
         }
     }
 
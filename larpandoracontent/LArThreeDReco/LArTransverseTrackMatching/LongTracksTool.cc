@@ -16,6 +16,7 @@ namespace lar_content
 {
 
 LongTracksTool::LongTracksTool() :
+    TransverseTensorTool(true),
     m_minMatchedFraction(0.9f),
     m_minMatchedSamplingPoints(20),
     m_minXOverlapFraction(0.9f),
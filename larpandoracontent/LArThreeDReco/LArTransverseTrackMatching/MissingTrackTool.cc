@@ -15,6 +15,7 @@ namespace lar_content
 {
 
 MissingTrackTool::MissingTrackTool() :
+    TransverseTensorTool(true),
     m_minMatchedSamplingPoints(15),
     m_minMatchedFraction(0.95f),
     m_maxReducedChiSquared(0.707f),
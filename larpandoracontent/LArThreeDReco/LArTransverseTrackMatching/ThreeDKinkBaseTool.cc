@@ -20,6 +20,7 @@ namespace lar_content
 {
 
 ThreeDKinkBaseTool::ThreeDKinkBaseTool(const unsigned int nCommonClusters) :
+    TransverseTensorTool(true),
     m_nCommonClusters(nCommonClusters),
     m_majorityRulesMode(false),
     m_minMatchedFraction(0.75f),
@@ -15,6 +15,7 @@
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewTrackMatchingAlgorithm.h"
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/ThreeViewMatchingControl.h"
+#include "larpandoracontent/LArThreeDReco/LArThreeDBase/TensorTool.h"
 
 namespace lar_content
 {
@@ -124,12 +125,19 @@ private:
 /**
  *  @brief  TransverseTensorTool class
  */
-class TransverseTensorTool : public pandora::AlgorithmTool
+class TransverseTensorTool : public TensorTool
 {
 public:
     typedef ThreeViewTransverseTracksAlgorithm::MatchingType::TensorType TensorType;
     typedef std::vector<TensorType::ElementList::const_iterator> IteratorList;
 
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  isComponentLocal whether the tool is component local
+     */
+    TransverseTensorTool(const bool isComponentLocal = false);
+
     /**
      *  @brief  Run the algorithm tool
      *
@@ -141,6 +149,12 @@ public:
     virtual bool Run(ThreeViewTransverseTracksAlgorithm *const pAlgorithm, TensorType &overlapTensor) = 0;
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline TransverseTensorTool::TransverseTensorTool(const bool isComponentLocal) : TensorTool(isComponentLocal)
+{
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_THREE_VIEW_TRANSVERSE_TRACKS_ALGORITHM_H
@@ -21,6 +21,7 @@ namespace lar_content
 {
 
 TrackSplittingTool::TrackSplittingTool() :
+    TransverseTensorTool(true),
     m_minMatchedFraction(0.75f),
     m_minMatchedSamplingPoints(10),
     m_minXOverlapFraction(0.75f),
@@ -20,6 +20,7 @@ namespace lar_content
 {
 
 TracksCrossingGapsTool::TracksCrossingGapsTool() :
+    TransverseTensorTool(true),
     m_minMatchedFraction(0.5f),
     m_minMatchedSamplingPoints(10),
     m_minXOverlapFraction(0.9f),
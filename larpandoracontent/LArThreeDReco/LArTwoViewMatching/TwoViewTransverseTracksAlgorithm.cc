@@ -25,6 +25,10 @@ TwoViewTransverseTracksAlgorithm::TwoViewTransverseTracksAlgorithm() :
     m_downsampleFactor(5),
     m_minSamples(11),
     m_nPermutations(1000),
+    m_earlyStopPermutationTests(false),
+    m_useStudentTDistribution(false),
+    m_nIntegrationSteps(100),
+    m_integrationUpperLimit(10.f),
     m_localMatchingScoreThreshold(0.99f),
     m_maxDotProduct(0.998f),
     m_minOverallMatchingScore(0.1f),
@@ -117,11 +121,12 @@ pandora::StatusCode TwoViewTransverseTracksAlgorithm::CalculateOverlapResult(
     const float correlation(
         LArDiscreteProbabilityHelper::CalculateCorrelationCoefficient(resampledDiscreteProbabilityVector1, resampledDiscreteProbabilityVector2));
 
-    const float pvalue(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
-        resampledDiscreteProbabilityVector1, resampledDiscreteProbabilityVector2, m_randomNumberGenerator, m_nPermutations));
+    bool isStoppedEarly(false);
+    const float pvalue(this->CalculateCorrelationPValue(resampledDiscreteProbabilityVector1, resampledDiscreteProbabilityVector2,
+        m_randomNumberGenerator, 1.f - m_minOverallMatchingScore, isStoppedEarly));
 
     const float matchingScore(1.f - pvalue);
-    if (matchingScore < m_minOverallMatchingScore)
+    if (isStoppedEarly || (matchingScore < m_minOverallMatchingScore))
         return STATUS_CODE_NOT_FOUND;
 
     const unsigned int nLocallyMatchedSamplingPoints(this->CalculateNumberOfLocallyMatchingSamplingPoints(
@@ -162,10 +167,11 @@ unsigned int TwoViewTransverseTracksAlgorithm::CalculateNumberOfLocallyMatchingS
         if (localValues1.size() == m_minSamples)
         {
             float localPValue(0);
+            bool isStoppedEarly(false);
             try
             {
-                localPValue = LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
-                    localValues1, localValues2, randomNumberGenerator, m_nPermutations);
+                localPValue = this->CalculateCorrelationPValue(
+                    localValues1, localValues2, randomNumberGenerator, 1.f - m_localMatchingScoreThreshold, isStoppedEarly);
             }
             catch (const StatusCodeException &)
             {
@@ -181,7 +187,7 @@ unsigned int TwoViewTransverseTracksAlgorithm::CalculateNumberOfLocallyMatchingS
                 std::cout << std::endl;
             }
 
-            if ((1.f - localPValue) - m_localMatchingScoreThreshold > std::numeric_limits<float>::epsilon())
+            if (!isStoppedEarly && ((1.f - localPValue) - m_localMatchingScoreThreshold > std::numeric_limits<float>::epsilon()))
                 nMatchedComparisons++;
 
             localValues1.erase(localValues1.begin());
@@ -193,6 +199,25 @@ unsigned int TwoViewTransverseTracksAlgorithm::CalculateNumberOfLocallyMatchingS
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+float TwoViewTransverseTracksAlgorithm::CalculateCorrelationPValue(
+    const T &t1, const T &t2, std::mt19937 &randomNumberGenerator, const float pValueThreshold, bool &isStoppedEarly) const
+{
+    isStoppedEarly = false;
+
+    if (m_useStudentTDistribution)
+        return LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromStudentTDistribution(
+            t1, t2, m_nIntegrationSteps, m_integrationUpperLimit);
+
+    if (!m_earlyStopPermutationTests)
+        return LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(t1, t2, randomNumberGenerator, m_nPermutations);
+
+    return LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
+        t1, t2, randomNumberGenerator, m_nPermutations, pValueThreshold, isStoppedEarly);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float TwoViewTransverseTracksAlgorithm::GetPrimaryAxisDotDriftAxis(const pandora::Cluster *const pCluster)
 {
     pandora::CartesianPointVector pointVector;
@@ -256,6 +281,18 @@ StatusCode TwoViewTransverseTracksAlgorithm::ReadSettings(const TiXmlHandle xmlH
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NPermutations", m_nPermutations));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "EarlyStopPermutationTests", m_earlyStopPermutationTests));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "UseStudentTDistribution", m_useStudentTDistribution));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NIntegrationSteps", m_nIntegrationSteps));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "IntegrationUpperLimit", m_integrationUpperLimit));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "LocalMatchingScoreThreshold", m_localMatchingScoreThreshold));
 
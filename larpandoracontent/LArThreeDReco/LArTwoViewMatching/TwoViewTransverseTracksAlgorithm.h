@@ -65,6 +65,21 @@ private:
     unsigned int CalculateNumberOfLocallyMatchingSamplingPoints(const DiscreteProbabilityVector &discreteProbabilityVector1,
         const DiscreteProbabilityVector &discreteProbabilityVector2, std::mt19937 &randomNumberGenerator);
 
+    /**
+     *  @brief  Calculate the p-value for the correlation between two datasets, via a permutation test or the student t distribution
+     *
+     *  @param  t1 the first dataset
+     *  @param  t2 the second dataset
+     *  @param  randomNumberGenerator a seeded random number generator, for the permutation test
+     *  @param  pValueThreshold the p-value threshold, above which a permutation test may be stopped early
+     *  @param  isStoppedEarly to receive whether a permutation test was stopped early, in which case the p-value must be rejected
+     *
+     *  @result the p-value
+     */
+    template <typename T>
+    float CalculateCorrelationPValue(
+        const T &t1, const T &t2, std::mt19937 &randomNumberGenerator, const float pValueThreshold, bool &isStoppedEarly) const;
+
     /**
      *  @brief  Get the dot product between the cluster's primary axis and the drift axis
      *
@@ -84,6 +99,10 @@ private:
     unsigned int m_downsampleFactor;          ///< The downsampling (hit merging) applied to hits in the overlap region
     unsigned int m_minSamples;                ///< The minimum number of samples needed for comparing charges
     unsigned int m_nPermutations;             ///< The number of permutations for calculating p-values
+    bool m_earlyStopPermutationTests;         ///< Whether to stop permutation tests once the p-value is certain to fail the relevant cut
+    bool m_useStudentTDistribution;           ///< Whether to calculate p-values by integrating the student t distribution, not permutation
+    unsigned int m_nIntegrationSteps;         ///< The number of steps in the student t distribution integration
+    float m_integrationUpperLimit;            ///< The upper limit of the student t distribution integration
     float m_localMatchingScoreThreshold;      ///< The minimum score to classify a local region as matching
     float m_maxDotProduct;                    ///M The maximum allowed cluster primary qxis Dot drift axis to fill the overlap result
     float m_minOverallMatchingScore;          ///< The minimum required global matching score to fill the overlap result
@@ -23,6 +23,14 @@ ClusterAssociationAlgorithm::ClusterAssociationAlgorithm() : m_mergeMade(false),
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode ClusterAssociationAlgorithm::Reset()
+{
+    EventArena::CheckLiveAllocations(this->GetInstanceName());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterAssociationAlgorithm::Run()
 {
     const ClusterList *pClusterList = NULL;
@@ -31,7 +39,7 @@ StatusCode ClusterAssociationAlgorithm::Run()
     ClusterVector clusterVector;
     this->GetListOfCleanClusters(pClusterList, clusterVector);
 
-    ClusterAssociationMap clusterAssociationMap;
+    ClusterAssociationMap clusterAssociationMap(EventArena::GetResource());
     this->PopulateClusterAssociationMap(clusterVector, clusterAssociationMap);
 
     m_mergeMade = true;
@@ -10,7 +10,7 @@
 
 #include "Pandora/Algorithm.h"
 
-#include <unordered_map>
+#include "larpandoracontent/LArObjects/LArEventArena.h"
 
 namespace lar_content
 {
@@ -27,6 +27,7 @@ public:
     ClusterAssociationAlgorithm();
 
 protected:
+    virtual pandora::StatusCode Reset();
     virtual pandora::StatusCode Run();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -40,7 +41,7 @@ protected:
         pandora::ClusterSet m_backwardAssociations; ///< The list of backward associations
     };
 
-    typedef std::unordered_map<const pandora::Cluster *, ClusterAssociation> ClusterAssociationMap;
+    typedef ArenaUnorderedMap<const pandora::Cluster *, ClusterAssociation> ClusterAssociationMap;
 
     /**
      *  @brief  Populate cluster vector with subset of cluster list, containing clusters judged to be clean
@@ -39,6 +39,9 @@ void HitWidthClusterMergingAlgorithm::GetListOfCleanClusters(const ClusterList *
     if (!m_clusterToParametersMap.empty())
         m_clusterToParametersMap.clear();
 
+    if (!m_clusterToParametersCacheMap.empty())
+        m_clusterToParametersCacheMap.clear();
+
     for (const Cluster *const pCluster : *pClusterList)
     {
         // the original cluster weight, with no hit scaling or hit padding
@@ -101,14 +104,12 @@ void HitWidthClusterMergingAlgorithm::PopulateClusterAssociationMap(const Cluste
 
 bool HitWidthClusterMergingAlgorithm::IsExtremalCluster(const bool isForward, const Cluster *const pCurrentCluster, const Cluster *const pTestCluster) const
 {
-    //ATTN - cannot use map since higherXExtrema may have changed during merging
-    const LArHitWidthHelper::ConstituentHitVector currentConstituentHitVector(
-        LArHitWidthHelper::GetConstituentHits(pCurrentCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
-    const LArHitWidthHelper::ConstituentHitVector testConstituentHitVector(
-        LArHitWidthHelper::GetConstituentHits(pTestCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
-    const CartesianVector currentHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(currentConstituentHitVector));
-    const CartesianVector testHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(testConstituentHitVector));
-    float currentMaxX(currentHigherXExtrema.GetX()), testMaxX(testHigherXExtrema.GetX());
+    //ATTN - cannot use map since higherXExtrema may have changed during merging, so use a cache refreshed when a cluster is enlarged.
+    // Merging only enlarges or deletes clusters (none are created), so a cached, dangling cluster address is never reused.
+    const float currentMaxX(LArHitWidthHelper::GetCachedClusterParameters(pCurrentCluster, m_maxConstituentHitWidth, false,
+        m_hitWidthScalingFactor, m_clusterToParametersCacheMap).GetHigherXExtrema().GetX());
+    const float testMaxX(LArHitWidthHelper::GetCachedClusterParameters(pTestCluster, m_maxConstituentHitWidth, false,
+        m_hitWidthScalingFactor, m_clusterToParametersCacheMap).GetHigherXExtrema().GetX());
 
     if (isForward)
     {
@@ -144,7 +145,7 @@ bool HitWidthClusterMergingAlgorithm::AreClustersAssociated(
     CartesianVector testMergePoint(0.f, 0.f, 0.f);
     if (testFitParameters.GetLowerXExtrema().GetX() < currentFitParameters.GetHigherXExtrema().GetX())
     {
-        this->FindClosestPointToPosition(currentFitParameters.GetHigherXExtrema(), testFitParameters.GetConstituentHitVector(), testMergePoint);
+        this->FindClosestPointToPosition(currentFitParameters.GetHigherXExtrema(), testFitParameters.GetConstituentHitArrays(), testMergePoint);
 
         // check closeness in z is maintained
         if (testMergePoint.GetZ() > (currentFitParameters.GetHigherXExtrema().GetZ() + m_maxZMergeDistance) ||
@@ -204,20 +205,12 @@ bool HitWidthClusterMergingAlgorithm::AreClustersAssociated(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void HitWidthClusterMergingAlgorithm::FindClosestPointToPosition(const CartesianVector &position,
-    const LArHitWidthHelper::ConstituentHitVector &constituentHitVector, CartesianVector &closestPoint) const
+    const LArHitWidthHelper::ConstituentHitArrays &constituentHitArrays, CartesianVector &closestPoint) const
 {
-    float minDistanceSquared(std::numeric_limits<float>::max());
-    for (const LArHitWidthHelper::ConstituentHit &constituentHit : constituentHitVector)
-    {
-        const CartesianVector &hitPosition(constituentHit.GetPositionVector());
-        const float separationDistanceSquared(hitPosition.GetDistanceSquared(position));
+    if (0 == constituentHitArrays.GetNConstituentHits())
+        return;
 
-        if (separationDistanceSquared < minDistanceSquared)
-        {
-            minDistanceSquared = separationDistanceSquared;
-            closestPoint = hitPosition;
-        }
-    }
+    closestPoint = LArHitWidthHelper::GetClosestConstituentHitPosition(position, constituentHitArrays);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -384,7 +377,7 @@ void HitWidthClusterMergingAlgorithm::GetGlobalDirection(const CartesianVector &
 void HitWidthClusterMergingAlgorithm::RemoveShortcutAssociations(const ClusterVector &clusterVector, ClusterAssociationMap &clusterAssociationMap) const
 {
     // Create temporary map so can delete elements whilst still iterating over them
-    ClusterAssociationMap tempMap(clusterAssociationMap);
+    ClusterAssociationMap tempMap(clusterAssociationMap, EventArena::GetResource());
 
     for (const Cluster *const pCluster : clusterVector)
     {
@@ -48,12 +48,12 @@ private:
      *  @brief  Determine the position of the constituent hit that lies closest to a specified position
      *
      *  @param  position the point to which the consituent hits will be compared
-     *  @param  constituentHitVector the input vector of constituent hits
+     *  @param  constituentHitArrays the input constituent hit arrays
      *  @param  closestPoint the position of the closest constituent hit
      *
      */
     void FindClosestPointToPosition(const pandora::CartesianVector &position,
-        const LArHitWidthHelper::ConstituentHitVector &constituentHitVector, pandora::CartesianVector &closestPoint) const;
+        const LArHitWidthHelper::ConstituentHitArrays &constituentHitArrays, pandora::CartesianVector &closestPoint) const;
 
     /**
      *  @brief  Determine the cluster direction at a reference point by performing a weighted least squared fit to the input consitutent hit positions
@@ -139,7 +139,8 @@ private:
     float m_minClusterSparseness;          ///< The threshold sparseness of a cluster to be considered in the merging process
 
     // ATTN Dangling pointers emerge during cluster merging, here explicitly not dereferenced
-    mutable LArHitWidthHelper::ClusterToParametersMap m_clusterToParametersMap; ///< The map [cluster -> cluster parameters]
+    mutable LArHitWidthHelper::ClusterToParametersMap m_clusterToParametersMap;      ///< The map [cluster -> cluster parameters]
+    mutable LArHitWidthHelper::ClusterToParametersMap m_clusterToParametersCacheMap; ///< The cache [cluster -> up-to-date cluster parameters]
 };
 
 } //namespace lar_content
@@ -76,7 +76,7 @@ void TransverseAssociationAlgorithm::PopulateClusterAssociationMap(const Cluster
 
         // Step 2: Form loose transverse associations between short clusters,
         //         without hopping over any established clusters
-        ClusterAssociationMap firstAssociationMap;
+        ClusterAssociationMap firstAssociationMap(EventArena::GetResource());
         this->FillReducedAssociationMap(nearbyClusters, shortClusters, establishedClusters, firstAssociationMap);
 
         // Step 3: Form transverse cluster objects. Basically, try to assign a direction to each
@@ -88,14 +88,14 @@ void TransverseAssociationAlgorithm::PopulateClusterAssociationMap(const Cluster
         // Step 4: Form loose transverse associations between transverse clusters
         //         (First, associate medium clusters, without hopping over long clusters
         //          Next, associate all transverse clusters, without hopping over any clusters)
-        ClusterAssociationMap secondAssociationMap;
+        ClusterAssociationMap secondAssociationMap(EventArena::GetResource());
         this->FillReducedAssociationMap(nearbyClusters, transverseMediumClusters, longClusters, secondAssociationMap);
         this->FillReducedAssociationMap(nearbyClusters, transverseClusters, allClusters, secondAssociationMap);
 
         // Step 5: Form associations between transverse cluster objects
         //         (These transverse associations must already exist as loose associations
         //          between transverse clusters as identified in the previous step).
-        ClusterAssociationMap transverseAssociationMap;
+        ClusterAssociationMap transverseAssociationMap(EventArena::GetResource());
         this->FillTransverseAssociationMap(nearbyClusters, transverseClusterList, secondAssociationMap, transverseAssociationMap);
 
         // Step 6: Finalise the forward/backward transverse associations by symmetrising the
@@ -199,8 +199,8 @@ void TransverseAssociationAlgorithm::FillReducedAssociationMap(const ClusterToCl
     // but prevent these associations from hopping over any clusters in the second cluster vector.
     // i.e. A->B from the first vector is forbidden if A->C->B exists with C from the second vector
 
-    ClusterAssociationMap firstAssociationMap, firstAssociationMapSwapped;
-    ClusterAssociationMap secondAssociationMap, secondAssociationMapSwapped;
+    ClusterAssociationMap firstAssociationMap(EventArena::GetResource()), firstAssociationMapSwapped(EventArena::GetResource());
+    ClusterAssociationMap secondAssociationMap(EventArena::GetResource()), secondAssociationMapSwapped(EventArena::GetResource());
 
     this->FillAssociationMap(nearbyClusters, firstVector, firstVector, firstAssociationMap, firstAssociationMapSwapped);
     this->FillAssociationMap(nearbyClusters, firstVector, secondVector, secondAssociationMap, secondAssociationMapSwapped);
@@ -769,7 +769,7 @@ void TransverseAssociationAlgorithm::FillSymmetricAssociationMap(
 void TransverseAssociationAlgorithm::FinalizeClusterAssociationMap(
     const ClusterAssociationMap &inputAssociationMap, ClusterAssociationMap &outputAssociationMap) const
 {
-    ClusterAssociationMap intermediateAssociationMap;
+    ClusterAssociationMap intermediateAssociationMap(EventArena::GetResource());
     this->FillSymmetricAssociationMap(inputAssociationMap, intermediateAssociationMap);
     this->FillReducedAssociationMap(intermediateAssociationMap, outputAssociationMap);
 }
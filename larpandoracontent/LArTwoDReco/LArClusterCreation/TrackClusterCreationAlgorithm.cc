@@ -28,6 +28,14 @@ TrackClusterCreationAlgorithm::TrackClusterCreationAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TrackClusterCreationAlgorithm::Reset()
+{
+    EventArena::CheckLiveAllocations(this->GetInstanceName());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TrackClusterCreationAlgorithm::Run()
 {
     const CaloHitList *pCaloHitList = NULL;
@@ -36,12 +44,12 @@ StatusCode TrackClusterCreationAlgorithm::Run()
     OrderedCaloHitList selectedCaloHitList, rejectedCaloHitList;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->FilterCaloHits(pCaloHitList, selectedCaloHitList, rejectedCaloHitList));
 
-    HitAssociationMap forwardHitAssociationMap, backwardHitAssociationMap;
+    HitAssociationMap forwardHitAssociationMap(EventArena::GetResource()), backwardHitAssociationMap(EventArena::GetResource());
     this->MakePrimaryAssociations(selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap);
     this->MakeSecondaryAssociations(selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap);
 
-    HitJoinMap hitJoinMap;
-    HitToClusterMap hitToClusterMap;
+    HitJoinMap hitJoinMap(EventArena::GetResource());
+    HitToClusterMap hitToClusterMap(EventArena::GetResource());
     this->IdentifyJoins(selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap, hitJoinMap);
     this->CreateClusters(selectedCaloHitList, hitJoinMap, hitToClusterMap);
 
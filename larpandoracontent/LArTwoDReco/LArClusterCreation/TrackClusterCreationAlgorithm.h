@@ -10,7 +10,7 @@
 
 #include "Pandora/Algorithm.h"
 
-#include <unordered_map>
+#include "larpandoracontent/LArObjects/LArEventArena.h"
 
 namespace lar_content
 {
@@ -84,10 +84,11 @@ private:
         float m_secondaryDistanceSquared;           ///< the secondary distance squared
     };
 
-    typedef std::unordered_map<const pandora::CaloHit *, HitAssociation> HitAssociationMap;
-    typedef std::unordered_map<const pandora::CaloHit *, const pandora::CaloHit *> HitJoinMap;
-    typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
+    typedef ArenaUnorderedMap<const pandora::CaloHit *, HitAssociation> HitAssociationMap;
+    typedef ArenaUnorderedMap<const pandora::CaloHit *, const pandora::CaloHit *> HitJoinMap;
+    typedef ArenaUnorderedMap<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
 
+    pandora::StatusCode Reset();
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
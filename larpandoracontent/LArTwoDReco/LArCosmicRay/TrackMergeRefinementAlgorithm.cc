@@ -45,6 +45,8 @@ StatusCode TrackMergeRefinementAlgorithm::Run()
 
     this->InitialiseContainers(pClusterList, LArClusterHelper::SortByNHits, clusterVector, slidingFitResultMapPair);
 
+    CaloHitGrid caloHitGrid(pClusterList, m_hitGridCellSize);
+
     // ATTN: Keep track of created main track clusters so their hits can be protected in future iterations
     unsigned int loopIterations(0);
     ClusterList createdMainTrackClusters;
@@ -60,7 +62,7 @@ StatusCode TrackMergeRefinementAlgorithm::Run()
         this->GetUnavailableProtectedClusters(clusterAssociation, createdMainTrackClusters, unavailableProtectedClusters);
 
         ClusterToCaloHitListMap clusterToCaloHitListMap;
-        this->GetHitsInBoundingBox(clusterAssociation.GetUpstreamMergePoint(), clusterAssociation.GetDownstreamMergePoint(), pClusterList,
+        this->GetHitsInBoundingBox(clusterAssociation.GetUpstreamMergePoint(), clusterAssociation.GetDownstreamMergePoint(), caloHitGrid,
             clusterToCaloHitListMap, unavailableProtectedClusters, m_distanceToLine);
 
         if (!this->AreExtrapolatedHitsGood(clusterToCaloHitListMap, clusterAssociation))
@@ -79,8 +81,8 @@ StatusCode TrackMergeRefinementAlgorithm::Run()
         if (downstreamIter != createdMainTrackClusters.end())
             createdMainTrackClusters.erase(downstreamIter);
 
-        createdMainTrackClusters.push_back(
-            this->CreateMainTrack(clusterAssociation, clusterToCaloHitListMap, pClusterList, clusterVector, slidingFitResultMapPair));
+        createdMainTrackClusters.push_back(this->CreateMainTrack(
+            clusterAssociation, clusterToCaloHitListMap, pClusterList, clusterVector, slidingFitResultMapPair, caloHitGrid));
     }
 
     return STATUS_CODE_SUCCESS;
@@ -245,7 +247,7 @@ void TrackMergeRefinementAlgorithm::ConsiderClusterAssociation(const ClusterPair
 
 const Cluster *TrackMergeRefinementAlgorithm::CreateMainTrack(const ClusterPairAssociation &clusterAssociation,
     const ClusterToCaloHitListMap &clusterToCaloHitListMap, const ClusterList *const pClusterList, ClusterVector &clusterVector,
-    SlidingFitResultMapPair &slidingFitResultMapPair) const
+    SlidingFitResultMapPair &slidingFitResultMapPair, CaloHitGrid &caloHitGrid) const
 {
     // Determine the shower clusters which contain hits that belong to the main track
     ClusterVector showerClustersToFragment;
@@ -281,7 +283,7 @@ const Cluster *TrackMergeRefinementAlgorithm::CreateMainTrack(const ClusterPairA
     modifiedClusters.push_back(clusterAssociation.GetUpstreamCluster());
     modifiedClusters.push_back(clusterAssociation.GetDownstreamCluster());
     createdClusters.push_back(pMainTrackCluster);
-    this->UpdateContainers(createdClusters, modifiedClusters, LArClusterHelper::SortByNHits, clusterVector, slidingFitResultMapPair);
+    this->UpdateContainers(createdClusters, modifiedClusters, LArClusterHelper::SortByNHits, clusterVector, slidingFitResultMapPair, caloHitGrid);
 
     return pMainTrackCluster;
 }
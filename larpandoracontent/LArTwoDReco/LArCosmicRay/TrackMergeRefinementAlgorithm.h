@@ -90,11 +90,13 @@ private:
      *  @param  pClusterList the list of all clusters
      *  @param  clusterVector the vector of clusters considered in future iterations of the algorithm
      *  @param  slidingFitResultMapPair the {micro, macro} pair of [cluster -> TwoDSlidingFitResult] maps
+     *  @param  caloHitGrid the grid of the hits in all clusters
      *
      *  @return  the address of the created main track cluster
      */
     const pandora::Cluster *CreateMainTrack(const ClusterPairAssociation &clusterAssociation, const ClusterToCaloHitListMap &clusterToCaloHitListMap,
-        const pandora::ClusterList *pClusterList, pandora::ClusterVector &clusterVector, SlidingFitResultMapPair &slidingFitResultMapPair) const;
+        const pandora::ClusterList *pClusterList, pandora::ClusterVector &clusterVector, SlidingFitResultMapPair &slidingFitResultMapPair,
+        CaloHitGrid &caloHitGrid) const;
 
     unsigned int m_maxLoopIterations;      ///< The maximum number of main loop iterations
     float m_minClusterLengthSum;           ///< The threshold cluster and associated cluster length sum
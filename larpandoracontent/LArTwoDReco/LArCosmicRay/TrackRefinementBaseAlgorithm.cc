@@ -30,7 +30,8 @@ TrackRefinementBaseAlgorithm::TrackRefinementBaseAlgorithm() :
     m_maxHitSeparationForConnectedCluster(4.f),
     m_maxTrackGaps(3),
     m_lineSegmentLength(3.f),
-    m_hitWidthMode(false)
+    m_hitWidthMode(false),
+    m_hitGridCellSize(2.f)
 {
 }
 
@@ -128,8 +129,8 @@ bool TrackRefinementBaseAlgorithm::GetClusterMergingCoordinates(const TwoDSlidin
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void TrackRefinementBaseAlgorithm::GetHitsInBoundingBox(const CartesianVector &firstCorner, const CartesianVector &secondCorner,
-    const ClusterList *const pClusterList, ClusterToCaloHitListMap &clusterToCaloHitListMap,
-    const ClusterList &unavailableProtectedClusters, const float distanceToLine) const
+    const CaloHitGrid &caloHitGrid, ClusterToCaloHitListMap &clusterToCaloHitListMap, const ClusterList &unavailableProtectedClusters,
+    const float distanceToLine) const
 {
     const float minX(std::min(firstCorner.GetX(), secondCorner.GetX())), maxX(std::max(firstCorner.GetX(), secondCorner.GetX()));
     const float minZ(std::min(firstCorner.GetZ(), secondCorner.GetZ())), maxZ(std::max(firstCorner.GetZ(), secondCorner.GetZ()));
@@ -137,31 +138,35 @@ void TrackRefinementBaseAlgorithm::GetHitsInBoundingBox(const CartesianVector &f
     CartesianVector connectingLineDirection(firstCorner - secondCorner);
     connectingLineDirection = connectingLineDirection.GetUnitVector();
 
-    for (const Cluster *const pCluster : *pClusterList)
+    const ClusterSet protectedClusters(unavailableProtectedClusters.begin(), unavailableProtectedClusters.end());
+
+    // ATTN: In hit width mode the tested position can lie up to half a hit width from the hit centre
+    const float xPadding(m_hitWidthMode ? 0.5f * caloHitGrid.GetMaxHitWidth() : 0.f);
+
+    CaloHitGrid::CaloHitClusterPairVector caloHitClusterPairVector;
+    caloHitGrid.GetCaloHits(minX - xPadding, maxX + xPadding, minZ, maxZ, caloHitClusterPairVector);
+
+    for (const CaloHitGrid::CaloHitClusterPair &caloHitClusterPair : caloHitClusterPairVector)
     {
-        if (std::find(unavailableProtectedClusters.begin(), unavailableProtectedClusters.end(), pCluster) != unavailableProtectedClusters.end())
-            continue;
+        const CaloHit *const pCaloHit(caloHitClusterPair.first);
+        const Cluster *const pCluster(caloHitClusterPair.second);
 
-        const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
-        for (const OrderedCaloHitList::value_type &mapEntry : orderedCaloHitList)
-        {
-            for (const CaloHit *const pCaloHit : *mapEntry.second)
-            {
-                CartesianVector hitPosition(m_hitWidthMode ? LArHitWidthHelper::GetClosestPointToLine2D(firstCorner, connectingLineDirection, pCaloHit)
-                                                           : pCaloHit->GetPositionVector());
+        if (protectedClusters.count(pCluster))
+            continue;
 
-                if (!this->IsInBoundingBox(minX, maxX, minZ, maxZ, hitPosition))
-                    continue;
+        CartesianVector hitPosition(m_hitWidthMode ? LArHitWidthHelper::GetClosestPointToLine2D(firstCorner, connectingLineDirection, pCaloHit)
+                                                   : pCaloHit->GetPositionVector());
 
-                if (distanceToLine > 0.f)
-                {
-                    if (!this->IsCloseToLine(hitPosition, firstCorner, connectingLineDirection, distanceToLine))
-                        continue;
-                }
+        if (!this->IsInBoundingBox(minX, maxX, minZ, maxZ, hitPosition))
+            continue;
 
-                clusterToCaloHitListMap[pCluster].push_back(pCaloHit);
-            }
+        if (distanceToLine > 0.f)
+        {
+            if (!this->IsCloseToLine(hitPosition, firstCorner, connectingLineDirection, distanceToLine))
+                continue;
         }
+
+        clusterToCaloHitListMap[pCluster].push_back(pCaloHit);
     }
 }
 
@@ -791,13 +796,15 @@ void TrackRefinementBaseAlgorithm::FragmentRemnantCluster(const Cluster *const p
 
 template <typename T>
 void TrackRefinementBaseAlgorithm::UpdateContainers(const ClusterList &clustersToAdd, const ClusterList &clustersToDelete,
-    const T sortFunction, ClusterVector &clusterVector, SlidingFitResultMapPair &slidingFitResultMapPair) const
+    const T sortFunction, ClusterVector &clusterVector, SlidingFitResultMapPair &slidingFitResultMapPair, CaloHitGrid &caloHitGrid) const
 {
     //ATTN: Very important to first delete pointers from containers
     for (const Cluster *const pClusterToDelete : clustersToDelete)
         this->RemoveClusterFromContainers(pClusterToDelete, clusterVector, slidingFitResultMapPair);
 
     this->InitialiseContainers(&clustersToAdd, sortFunction, clusterVector, slidingFitResultMapPair);
+
+    caloHitGrid.Update(clustersToDelete);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -862,6 +869,15 @@ StatusCode TrackRefinementBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandl
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "HitWidthMode", m_hitWidthMode));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "HitGridCellSize", m_hitGridCellSize));
+
+    if (m_hitGridCellSize < std::numeric_limits<float>::epsilon())
+    {
+        std::cout << "TrackRefinementBaseAlgorithm: Hit grid cell size must be positive and nonzero" << std::endl;
+        throw STATUS_CODE_INVALID_PARAMETER;
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -889,12 +905,159 @@ bool TrackRefinementBaseAlgorithm::SortByDistanceAlongLine::operator()(const pan
     return LArClusterHelper::SortHitsByPulseHeight(pLhs, pRhs);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TrackRefinementBaseAlgorithm::CaloHitGrid::CaloHitGrid(const ClusterList *const pClusterList, const float cellSize) :
+    m_pClusterList(pClusterList),
+    m_cellSize(cellSize),
+    m_maxHitWidth(0.f)
+{
+    if (m_cellSize < std::numeric_limits<float>::epsilon())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    for (const Cluster *const pCluster : *m_pClusterList)
+        this->AddCluster(pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackRefinementBaseAlgorithm::CaloHitGrid::Update(const ClusterList &deletedClusters)
+{
+    // ATTN: Deleted clusters must be removed first, as their addresses may since have been reused by newly created clusters
+    for (const Cluster *const pDeletedCluster : deletedClusters)
+        this->RemoveCluster(pDeletedCluster);
+
+    ClusterList modifiedClusters;
+    for (const ClusterToCaloHitListMap::value_type &mapEntry : m_clusterToCaloHitListMap)
+    {
+        if (mapEntry.second.size() != mapEntry.first->GetNCaloHits())
+            modifiedClusters.push_back(mapEntry.first);
+    }
+
+    for (const Cluster *const pModifiedCluster : modifiedClusters)
+        this->RemoveCluster(pModifiedCluster);
+
+    for (const Cluster *const pCluster : *m_pClusterList)
+    {
+        if (!m_clusterToCaloHitListMap.count(pCluster))
+            this->AddCluster(pCluster);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackRefinementBaseAlgorithm::CaloHitGrid::GetCaloHits(
+    const float minX, const float maxX, const float minZ, const float maxZ, CaloHitClusterPairVector &caloHitClusterPairVector) const
+{
+    const int minXCell(this->GetCellCoordinate(minX)), maxXCell(this->GetCellCoordinate(maxX));
+    const int minZCell(this->GetCellCoordinate(minZ)), maxZCell(this->GetCellCoordinate(maxZ));
+
+    if ((maxXCell < minXCell) || (maxZCell < minZCell))
+        return;
+
+    const int64_t nCellsInBox((static_cast<int64_t>(maxXCell) - minXCell + 1) * (static_cast<int64_t>(maxZCell) - minZCell + 1));
+
+    // ATTN: Visit the occupied cells directly if the box spans more cells than are occupied
+    if (nCellsInBox > static_cast<int64_t>(m_cellMap.size()))
+    {
+        for (const CellMap::value_type &mapEntry : m_cellMap)
+        {
+            const int xCell(static_cast<int32_t>(static_cast<uint32_t>(mapEntry.first >> 32)));
+            const int zCell(static_cast<int32_t>(static_cast<uint32_t>(mapEntry.first)));
+
+            if ((xCell < minXCell) || (xCell > maxXCell) || (zCell < minZCell) || (zCell > maxZCell))
+                continue;
+
+            caloHitClusterPairVector.insert(caloHitClusterPairVector.end(), mapEntry.second.begin(), mapEntry.second.end());
+        }
+
+        return;
+    }
+
+    for (int xCell = minXCell; xCell <= maxXCell; ++xCell)
+    {
+        for (int zCell = minZCell; zCell <= maxZCell; ++zCell)
+        {
+            const CellMap::const_iterator cellIter(m_cellMap.find(this->GetCellKey(xCell, zCell)));
+
+            if (cellIter != m_cellMap.end())
+                caloHitClusterPairVector.insert(caloHitClusterPairVector.end(), cellIter->second.begin(), cellIter->second.end());
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackRefinementBaseAlgorithm::CaloHitGrid::AddCluster(const Cluster *const pCluster)
+{
+    CaloHitList &caloHitList(m_clusterToCaloHitListMap[pCluster]);
+    pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+    for (const CaloHit *const pCaloHit : caloHitList)
+    {
+        const CartesianVector &hitPosition(pCaloHit->GetPositionVector());
+        const uint64_t cellKey(this->GetCellKey(this->GetCellCoordinate(hitPosition.GetX()), this->GetCellCoordinate(hitPosition.GetZ())));
+
+        m_cellMap[cellKey].emplace_back(pCaloHit, pCluster);
+        m_maxHitWidth = std::max(m_maxHitWidth, pCaloHit->GetCellSize1());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackRefinementBaseAlgorithm::CaloHitGrid::RemoveCluster(const Cluster *const pCluster)
+{
+    const ClusterToCaloHitListMap::iterator clusterIter(m_clusterToCaloHitListMap.find(pCluster));
+
+    if (clusterIter == m_clusterToCaloHitListMap.end())
+        return;
+
+    for (const CaloHit *const pCaloHit : clusterIter->second)
+    {
+        const CartesianVector &hitPosition(pCaloHit->GetPositionVector());
+        const CellMap::iterator cellIter(
+            m_cellMap.find(this->GetCellKey(this->GetCellCoordinate(hitPosition.GetX()), this->GetCellCoordinate(hitPosition.GetZ()))));
+
+        if (cellIter == m_cellMap.end())
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        CaloHitClusterPairVector &cellContents(cellIter->second);
+        const CaloHitClusterPairVector::iterator hitIter(
+            std::find(cellContents.begin(), cellContents.end(), CaloHitClusterPair(pCaloHit, pCluster)));
+
+        if (hitIter == cellContents.end())
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        cellContents.erase(hitIter);
+
+        if (cellContents.empty())
+            m_cellMap.erase(cellIter);
+    }
+
+    m_clusterToCaloHitListMap.erase(clusterIter);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int TrackRefinementBaseAlgorithm::CaloHitGrid::GetCellCoordinate(const float position) const
+{
+    return static_cast<int>(std::floor(position / m_cellSize));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+uint64_t TrackRefinementBaseAlgorithm::CaloHitGrid::GetCellKey(const int xCell, const int zCell) const
+{
+    return ((static_cast<uint64_t>(static_cast<uint32_t>(xCell)) << 32) | static_cast<uint32_t>(zCell));
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 typedef bool (*SortFunction)(const Cluster *, const Cluster *);
 
 template void TrackRefinementBaseAlgorithm::UpdateContainers<SortFunction>(
-    const ClusterList &, const ClusterList &, const SortFunction, ClusterVector &, SlidingFitResultMapPair &) const;
+    const ClusterList &, const ClusterList &, const SortFunction, ClusterVector &, SlidingFitResultMapPair &, CaloHitGrid &) const;
 template void TrackRefinementBaseAlgorithm::InitialiseContainers<SortFunction>(
     const ClusterList *, const SortFunction, ClusterVector &, SlidingFitResultMapPair &) const;
 
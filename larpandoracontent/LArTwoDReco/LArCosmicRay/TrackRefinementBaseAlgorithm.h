@@ -13,6 +13,9 @@
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 #include "larpandoracontent/LArTwoDReco/LArCosmicRay/ClusterAssociation.h"
 
+#include <cstdint>
+#include <unordered_map>
+
 namespace lar_content
 {
 /**
@@ -61,6 +64,93 @@ protected:
         bool m_hitWidthMode;                      ///< Wether to consider hit widths or not
     };
 
+    /**
+     *  @brief  CaloHitGrid class, a uniform 2D (x, z) grid of the hits in the clusters of a list, updated incrementally as clusters change
+     */
+    class CaloHitGrid
+    {
+    public:
+        typedef std::pair<const pandora::CaloHit *, const pandora::Cluster *> CaloHitClusterPair;
+        typedef std::vector<CaloHitClusterPair> CaloHitClusterPairVector;
+
+        /**
+         *  @brief  Constructor, indexing the hits of all clusters in the list
+         *
+         *  @param  pClusterList the address of the cluster list, which must remain valid and up to date for the lifetime of the grid
+         *  @param  cellSize the grid cell size
+         */
+        CaloHitGrid(const pandora::ClusterList *const pClusterList, const float cellSize);
+
+        /**
+         *  @brief  Update the grid to reflect the current content of the cluster list. Clusters in the deleted list are never dereferenced.
+         *          Other clusters are re-indexed if their number of hits has changed.
+         *
+         *  @param  deletedClusters the clusters that have been deleted or modified since the last update
+         */
+        void Update(const pandora::ClusterList &deletedClusters);
+
+        /**
+         *  @brief  Get the hits, and their parent clusters, in all grid cells overlapping a specified box
+         *
+         *  @param  minX the minimum x coordinate of the box
+         *  @param  maxX the maximum x coordinate of the box
+         *  @param  minZ the minimum z coordinate of the box
+         *  @param  maxZ the maximum z coordinate of the box
+         *  @param  caloHitClusterPairVector to receive the hits and their parent clusters
+         */
+        void GetCaloHits(
+            const float minX, const float maxX, const float minZ, const float maxZ, CaloHitClusterPairVector &caloHitClusterPairVector) const;
+
+        /**
+         *  @brief  Get the largest width of any hit added to the grid
+         *
+         *  @return  the largest hit width
+         */
+        float GetMaxHitWidth() const;
+
+    private:
+        typedef std::unordered_map<uint64_t, CaloHitClusterPairVector> CellMap;
+
+        /**
+         *  @brief  Add the hits of a cluster to the grid
+         *
+         *  @param  pCluster the address of the cluster
+         */
+        void AddCluster(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Remove the indexed hits of a cluster from the grid, without dereferencing the cluster
+         *
+         *  @param  pCluster the address of the cluster
+         */
+        void RemoveCluster(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Get the grid cell coordinate for a position
+         *
+         *  @param  position the x or z position
+         *
+         *  @return  the cell coordinate
+         */
+        int GetCellCoordinate(const float position) const;
+
+        /**
+         *  @brief  Get the key of a grid cell
+         *
+         *  @param  xCell the cell x coordinate
+         *  @param  zCell the cell z coordinate
+         *
+         *  @return  the cell key
+         */
+        uint64_t GetCellKey(const int xCell, const int zCell) const;
+
+        const pandora::ClusterList *m_pClusterList;        ///< The address of the cluster list
+        float m_cellSize;                                  ///< The grid cell size
+        float m_maxHitWidth;                               ///< The largest width of any hit added to the grid
+        CellMap m_cellMap;                                 ///< The map from cell key to the hits in the cell
+        ClusterToCaloHitListMap m_clusterToCaloHitListMap; ///< The map from indexed cluster to its indexed hits
+    };
+
     virtual pandora::StatusCode Run() = 0;
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle) = 0;
 
@@ -97,13 +187,13 @@ protected:
      *
      *  @param  firstCorner the position of one corner
      *  @param  secondCorner the position of the opposite corner
-     *  @param  pClusterList the list of all clusters
+     *  @param  caloHitGrid the grid of the hits in all clusters
      *  @param  clusterToCaloHitListMap the output map [parent cluster -> list of hits which belong to the main track]
      *  @param  unavailableProtectedClusters the list of clusters whose hits are protected
      *  @param  distanceToLine the maximum perpendicular distance of a collected hit from the connecting line
      */
     void GetHitsInBoundingBox(const pandora::CartesianVector &firstCorner, const pandora::CartesianVector &secondCorner,
-        const pandora::ClusterList *const pClusterList, ClusterToCaloHitListMap &clusterToCaloHitListMap,
+        const CaloHitGrid &caloHitGrid, ClusterToCaloHitListMap &clusterToCaloHitListMap,
         const pandora::ClusterList &unavailableProtectedClusters = pandora::ClusterList(), const float distanceToLine = -1.f) const;
 
     /**
@@ -289,10 +379,11 @@ protected:
      *  @param  sortFunction the sort class or function used to sort the clusterVector
      *  @param  clusterVector the vector to store clusters considered within the algorithm
      *  @param  slidingFitResultMapPair the {micro, macro} pair of [cluster -> TwoDSlidingFitResult] maps
+     *  @param  caloHitGrid the grid of the hits in all clusters
      */
     template <typename T>
     void UpdateContainers(const pandora::ClusterList &clustersToAdd, const pandora::ClusterList &clustersToDelete, const T sortFunction,
-        pandora::ClusterVector &clusterVector, SlidingFitResultMapPair &slidingFitResultMapPair) const;
+        pandora::ClusterVector &clusterVector, SlidingFitResultMapPair &slidingFitResultMapPair, CaloHitGrid &caloHitGrid) const;
 
     /**
      *  @brief  Remove a cluster from the cluster vector and sliding fit maps
@@ -316,6 +407,7 @@ protected:
     unsigned int m_maxTrackGaps;                 ///< The maximum number of graps allowed in the extrapolated hit vector
     float m_lineSegmentLength;                   ///< The length of a track gap
     bool m_hitWidthMode;                         ///< Whether to consider the width of hits
+    float m_hitGridCellSize;                     ///< The cell size of the hit grid used for bounding box queries
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -328,6 +420,13 @@ inline TrackRefinementBaseAlgorithm::SortByDistanceAlongLine::SortByDistanceAlon
 {
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float TrackRefinementBaseAlgorithm::CaloHitGrid::GetMaxHitWidth() const
+{
+    return m_maxHitWidth;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef TRACK_REFINEMENT_BASE_ALGORITHM_H
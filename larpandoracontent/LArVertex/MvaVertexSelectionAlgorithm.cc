@@ -74,23 +74,25 @@ void MvaVertexSelectionAlgorithm<T>::GetVertexScoreList(const VertexVector &vert
     LArMvaHelper::MvaFeatureVector eventFeatureList;
     this->AddEventFeaturesToVector(eventFeatureInfo, eventFeatureList);
 
+    // Use a cheap pre-score to discard low-ranking candidates in each region before the full feature evaluation.
+    VertexVector candidateVertices;
+    this->PruneVertexCandidates(
+        beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, vertexVector, candidateVertices);
+
     VertexFeatureInfoMap vertexFeatureInfoMap;
-    for (const Vertex *const pVertex : vertexVector)
-    {
-        this->PopulateVertexFeatureInfoMap(
-            beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex, vertexFeatureInfoMap);
-    }
+    this->PopulateVertexFeatureInfoMap(
+        beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, candidateVertices, vertexFeatureInfoMap);
 
     // Use a simple score to get the list of vertices representing good regions.
     VertexScoreList initialScoreList;
-    for (const Vertex *const pVertex : vertexVector)
+    for (const Vertex *const pVertex : candidateVertices)
         PopulateInitialScoreList(vertexFeatureInfoMap, pVertex, initialScoreList);
 
     VertexVector bestRegionVertices;
     this->GetBestRegionVertices(initialScoreList, bestRegionVertices);
 
     if (m_trainingSetMode)
-        this->ProduceTrainingSets(vertexVector, bestRegionVertices, vertexFeatureInfoMap, eventFeatureList, kdTreeMap);
+        this->ProduceTrainingSets(candidateVertices, bestRegionVertices, vertexFeatureInfoMap, eventFeatureList, kdTreeMap);
 
     if ((!m_trainingSetMode || m_allowClassifyDuringTraining) && !bestRegionVertices.empty())
     {
@@ -100,7 +102,7 @@ void MvaVertexSelectionAlgorithm<T>::GetVertexScoreList(const VertexVector &vert
 
         // Get all the vertices in the best region.
         VertexVector regionalVertices{pBestRegionVertex};
-        for (const Vertex *const pVertex : vertexVector)
+        for (const Vertex *const pVertex : candidateVertices)
         {
             if (pVertex == pBestRegionVertex)
                 continue;
@@ -116,7 +118,7 @@ void MvaVertexSelectionAlgorithm<T>::GetVertexScoreList(const VertexVector &vert
             // Use mva to choose the vertex and then fine-tune using the RPhi score.
             const Vertex *const pBestVertex(
                 this->CompareVertices(regionalVertices, vertexFeatureInfoMap, eventFeatureList, kdTreeMap, m_mvaVertex, true));
-            this->PopulateFinalVertexScoreList(vertexFeatureInfoMap, pBestVertex, vertexVector, vertexScoreList);
+            this->PopulateFinalVertexScoreList(vertexFeatureInfoMap, pBestVertex, candidateVertices, vertexScoreList);
         }
     }
 }
@@ -13,6 +13,8 @@
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -29,7 +31,9 @@ RPhiFeatureTool::RPhiFeatureTool() :
     m_fastHistogramNPhiBins(200),
     m_fastHistogramPhiMin(-1.1f * M_PI),
     m_fastHistogramPhiMax(+1.1f * M_PI),
-    m_enableFolding(true)
+    m_enableFolding(true),
+    m_kernelEstimateTolerance(0.f),
+    m_gaussianLookupTable(m_kernelEstimateTolerance, 3.f)
 {
 }
 
@@ -43,9 +47,9 @@ void RPhiFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const V
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
-    KernelEstimate kernelEstimateU(m_kernelEstimateSigma);
-    KernelEstimate kernelEstimateV(m_kernelEstimateSigma);
-    KernelEstimate kernelEstimateW(m_kernelEstimateSigma);
+    KernelEstimate kernelEstimateU(m_kernelEstimateSigma, m_gaussianLookupTable);
+    KernelEstimate kernelEstimateV(m_kernelEstimateSigma, m_gaussianLookupTable);
+    KernelEstimate kernelEstimateW(m_kernelEstimateSigma, m_gaussianLookupTable);
 
     this->FillKernelEstimate(pVertex, TPC_VIEW_U, kdTreeMap.at(TPC_VIEW_U), kernelEstimateU);
     this->FillKernelEstimate(pVertex, TPC_VIEW_V, kdTreeMap.at(TPC_VIEW_V), kernelEstimateV);
@@ -147,18 +151,7 @@ float RPhiFeatureTool::GetMidwayScore(const KernelEstimate &kernelEstimateU, con
 
 float RPhiFeatureTool::GetFullScore(const KernelEstimate &kernelEstimateU, const KernelEstimate &kernelEstimateV, const KernelEstimate &kernelEstimateW) const
 {
-    float figureOfMerit(0.f);
-
-    for (const KernelEstimate::ContributionList::value_type &contribution : kernelEstimateU.GetContributionList())
-        figureOfMerit += contribution.second * kernelEstimateU.Sample(contribution.first);
-
-    for (const KernelEstimate::ContributionList::value_type &contribution : kernelEstimateV.GetContributionList())
-        figureOfMerit += contribution.second * kernelEstimateV.Sample(contribution.first);
-
-    for (const KernelEstimate::ContributionList::value_type &contribution : kernelEstimateW.GetContributionList())
-        figureOfMerit += contribution.second * kernelEstimateW.Sample(contribution.first);
-
-    return figureOfMerit;
+    return kernelEstimateU.GetSelfConvolution() + kernelEstimateV.GetSelfConvolution() + kernelEstimateW.GetSelfConvolution();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -191,6 +184,8 @@ void RPhiFeatureTool::FillKernelEstimate(const Vertex *const pVertex, const HitT
 
         kernelEstimate.AddContribution(phi, weight);
     }
+
+    kernelEstimate.SortContributions();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -212,11 +207,53 @@ float RPhiFeatureTool::atan2Fast(const float y, const float x) const
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+RPhiFeatureTool::GaussianLookupTable::GaussianLookupTable(const float tolerance, const float maxX) : m_inverseStep(0.f)
+{
+    if (tolerance < 0.f)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    if ((tolerance < std::numeric_limits<float>::epsilon()) || (maxX < std::numeric_limits<float>::epsilon()))
+        return;
+
+    // ATTN Linear interpolation error is bounded by step^2 max|f''| / 8, and max|f''| = 1 for exp(-x^2 / 2)
+    const unsigned int nSteps(static_cast<unsigned int>(std::ceil(maxX / std::sqrt(8.f * tolerance))));
+    const float step(maxX / static_cast<float>(nSteps));
+    m_inverseStep = 1.f / step;
+
+    for (unsigned int iStep = 0; iStep <= nSteps; ++iStep)
+    {
+        const float x(static_cast<float>(iStep) * step);
+        m_values.push_back(std::exp(-0.5f * x * x));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float RPhiFeatureTool::GaussianLookupTable::Evaluate(const float x) const
+{
+    const float position(std::fabs(x) * m_inverseStep);
+    const unsigned int bin(static_cast<unsigned int>(position));
+
+    if (bin + 1 >= m_values.size())
+        return std::exp(-0.5f * x * x);
+
+    const float lowValue(m_values[bin]);
+    return lowValue + (position - static_cast<float>(bin)) * (m_values[bin + 1] - lowValue);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float RPhiFeatureTool::KernelEstimate::Sample(const float x) const
 {
+    if (!m_isSorted)
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
     const ContributionList &contributionList(this->GetContributionList());
-    ContributionList::const_iterator lowerIter(contributionList.lower_bound(x - 3.f * m_sigma));
-    ContributionList::const_iterator upperIter(contributionList.upper_bound(x + 3.f * m_sigma));
+    ContributionList::const_iterator lowerIter(std::lower_bound(contributionList.begin(), contributionList.end(), x - 3.f * m_sigma,
+        [](const ContributionList::value_type &contribution, const float value) { return contribution.first < value; }));
+    ContributionList::const_iterator upperIter(std::upper_bound(lowerIter, contributionList.end(), x + 3.f * m_sigma,
+        [](const float value, const ContributionList::value_type &contribution) { return value < contribution.first; }));
 
     float sample(0.f);
     const float gaussConstant(1.f / std::sqrt(2.f * M_PI * m_sigma * m_sigma));
@@ -224,7 +261,7 @@ float RPhiFeatureTool::KernelEstimate::Sample(const float x) const
     for (ContributionList::const_iterator iter = lowerIter; iter != upperIter; ++iter)
     {
         const float deltaSigma((x - iter->first) / m_sigma);
-        const float gaussian(gaussConstant * std::exp(-0.5f * deltaSigma * deltaSigma));
+        const float gaussian(gaussConstant * m_gaussianLookupTable.Evaluate(deltaSigma));
         sample += iter->second * gaussian;
     }
 
@@ -233,9 +270,54 @@ float RPhiFeatureTool::KernelEstimate::Sample(const float x) const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float RPhiFeatureTool::KernelEstimate::GetSelfConvolution() const
+{
+    if (!m_isSorted)
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    const ContributionList &contributionList(this->GetContributionList());
+    const size_t nContributions(contributionList.size());
+    const float maxDelta(3.f * m_sigma);
+
+    float diagonalSum(0.f), offDiagonalSum(0.f);
+
+    for (size_t i = 0; i < nContributions; ++i)
+    {
+        const float x(contributionList[i].first), weight(contributionList[i].second);
+        diagonalSum += weight * weight;
+
+        // ATTN Contributions are sorted, so only those above this one and within the kernel window need be visited
+        float neighbourSum(0.f);
+
+        for (size_t j = i + 1; (j < nContributions) && (contributionList[j].first - x <= maxDelta); ++j)
+            neighbourSum += contributionList[j].second * m_gaussianLookupTable.Evaluate((contributionList[j].first - x) / m_sigma);
+
+        offDiagonalSum += weight * neighbourSum;
+    }
+
+    const float gaussConstant(1.f / std::sqrt(2.f * M_PI * m_sigma * m_sigma));
+
+    return gaussConstant * (diagonalSum + 2.f * offDiagonalSum);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void RPhiFeatureTool::KernelEstimate::AddContribution(const float x, const float weight)
 {
-    m_contributionList.insert(ContributionList::value_type(x, weight));
+    m_contributionList.emplace_back(x, weight);
+    m_isSorted = false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RPhiFeatureTool::KernelEstimate::SortContributions()
+{
+    if (m_isSorted)
+        return;
+
+    std::stable_sort(m_contributionList.begin(), m_contributionList.end(),
+        [](const ContributionList::value_type &lhs, const ContributionList::value_type &rhs) { return lhs.first < rhs.first; });
+    m_isSorted = true;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -270,6 +352,17 @@ StatusCode RPhiFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "EnableFolding", m_enableFolding));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "KernelEstimateTolerance", m_kernelEstimateTolerance));
+
+    if (m_kernelEstimateTolerance < 0.f)
+    {
+        std::cout << "RPhiFeatureTool: KernelEstimateTolerance must not be negative" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    m_gaussianLookupTable = GaussianLookupTable(m_kernelEstimateTolerance, 3.f);
+
     return STATUS_CODE_SUCCESS;
 }
 
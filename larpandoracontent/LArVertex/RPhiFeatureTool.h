@@ -12,6 +12,9 @@
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <utility>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -43,6 +46,34 @@ public:
         const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const float beamDeweightingScore, float &bestFastScore);
 
 private:
+    /**
+     *  @brief  Gaussian lookup table class, tabulating exp(-x^2 / 2) for linear interpolation within a specified absolute tolerance
+     */
+    class GaussianLookupTable
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  tolerance the maximum absolute interpolation error, relative to the peak value (zero to evaluate exactly)
+         *  @param  maxX the maximum |x| to tabulate, beyond which the exact value is evaluated
+         */
+        GaussianLookupTable(const float tolerance, const float maxX);
+
+        /**
+         *  @brief  Evaluate exp(-x^2 / 2)
+         *
+         *  @param  x the position at which to evaluate
+         *
+         *  @return the (interpolated) value
+         */
+        float Evaluate(const float x) const;
+
+    private:
+        pandora::FloatVector m_values; ///< The tabulated values, at uniformly spaced |x|, starting at zero
+        float m_inverseStep;           ///< The inverse of the spacing between tabulated values
+    };
+
     /**
      *  @brief Kernel estimate class
      */
@@ -53,8 +84,9 @@ private:
          *  @brief  Constructor
          *
          *  @param  sigma the width associated with the kernel estimate
+         *  @param  gaussianLookupTable the gaussian lookup table to use when sampling
          */
-        KernelEstimate(const float sigma);
+        KernelEstimate(const float sigma, const GaussianLookupTable &gaussianLookupTable);
 
         /**
          *  @brief  Sample the parameterised distribution at a specified x coordinate
@@ -65,7 +97,15 @@ private:
          */
         float Sample(const float x) const;
 
-        typedef std::multimap<float, float> ContributionList; ///< Map from x coord to weight, ATTN avoid map.find, etc. with float key
+        /**
+         *  @brief  Get the sum, over all contributions, of the contribution weight multiplied by the distribution sampled at the
+         *          contribution position. Uses the symmetry of the kernel to visit each contribution pair once.
+         *
+         *  @return the self convolution
+         */
+        float GetSelfConvolution() const;
+
+        typedef std::vector<std::pair<float, float>> ContributionList; ///< Vector of x coord and weight pairs, sorted by x coord
 
         /**
          *  @brief  Get the contribution list
@@ -89,9 +129,16 @@ private:
          */
         void AddContribution(const float x, const float weight);
 
+        /**
+         *  @brief  Sort the contributions by x coord, required after adding contributions and before sampling
+         */
+        void SortContributions();
+
     private:
-        ContributionList m_contributionList; ///< The contribution list
-        const float m_sigma;                 ///< The assigned width
+        ContributionList m_contributionList;              ///< The contribution list
+        const float m_sigma;                              ///< The assigned width
+        const GaussianLookupTable &m_gaussianLookupTable; ///< The gaussian lookup table
+        bool m_isSorted;                                  ///< Whether the contribution list is sorted
     };
 
     //--------------------------------------------------------------------------------------------------------------------------------------
@@ -176,11 +223,17 @@ private:
     float m_fastHistogramPhiMax;          ///< Max value for fast score histograms
 
     bool m_enableFolding; ///< Whether to enable folding of -pi -> +pi phi distribution into 0 -> +pi region only
+
+    float m_kernelEstimateTolerance;           ///< Max gaussian interpolation error (relative to peak) in kernel estimation, zero for exact
+    GaussianLookupTable m_gaussianLookupTable; ///< The gaussian lookup table used for kernel estimation
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline RPhiFeatureTool::KernelEstimate::KernelEstimate(const float sigma) : m_sigma(sigma)
+inline RPhiFeatureTool::KernelEstimate::KernelEstimate(const float sigma, const GaussianLookupTable &gaussianLookupTable) :
+    m_sigma(sigma),
+    m_gaussianLookupTable(gaussianLookupTable),
+    m_isSorted(true)
 {
     if (m_sigma < std::numeric_limits<float>::epsilon())
         throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
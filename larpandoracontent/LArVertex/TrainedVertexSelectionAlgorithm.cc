@@ -14,6 +14,7 @@
 #include "larpandoracontent/LArHelpers/LArInteractionTypeHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
+#include "larpandoracontent/LArHelpers/LArParallelHelper.h"
 
 #include "larpandoracontent/LArVertex/EnergyDepositionAsymmetryFeatureTool.h"
 #include "larpandoracontent/LArVertex/EnergyKickFeatureTool.h"
@@ -26,7 +27,9 @@
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <memory>
 #include <random>
+#include <unordered_set>
 
 using namespace pandora;
 
@@ -56,7 +59,9 @@ TrainedVertexSelectionAlgorithm::TrainedVertexSelectionAlgorithm() :
     m_dropFailedRPhiFastScoreCandidates(true),
     m_testBeamMode(false),
     m_legacyEventShapes(true),
-    m_legacyVariables(true)
+    m_legacyVariables(true),
+    m_nFeatureThreads(1),
+    m_maxCandidatesPerRegion(0)
 {
 }
 
@@ -424,7 +429,104 @@ void TrainedVertexSelectionAlgorithm::AddEventFeaturesToVector(const EventFeatur
 
 void TrainedVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
     const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
-    const Vertex *const pVertex, VertexFeatureInfoMap &vertexFeatureInfoMap) const
+    const VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap) const
+{
+    // ATTN Features are evaluated into per-vertex slots, then inserted in vertex order, so the map is independent of the thread count
+    std::vector<std::unique_ptr<VertexFeatureInfo>> vertexFeatureInfoVector(vertexVector.size());
+
+    LArParallelHelper::ForEachIndex(vertexVector.size(), m_nFeatureThreads, [&](const std::size_t index) {
+        vertexFeatureInfoVector.at(index) = std::make_unique<VertexFeatureInfo>(this->CalculateVertexFeatureInfo(
+            beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, vertexVector.at(index)));
+    });
+
+    for (std::size_t index = 0; index < vertexVector.size(); ++index)
+        vertexFeatureInfoMap.emplace(vertexVector.at(index), *vertexFeatureInfoVector.at(index));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrainedVertexSelectionAlgorithm::PruneVertexCandidates(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
+    const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+    const VertexVector &vertexVector, VertexVector &candidateVertices) const
+{
+    // ATTN Training requires the full features for every candidate
+    if (m_trainingSetMode || (0 == m_maxCandidatesPerRegion))
+    {
+        candidateVertices = vertexVector;
+        return;
+    }
+
+    FloatVector preScores(vertexVector.size(), 0.f);
+
+    LArParallelHelper::ForEachIndex(vertexVector.size(), m_nFeatureThreads, [&](const std::size_t index) {
+        const Vertex *const pVertex(vertexVector.at(index));
+        float bestFastScore(-std::numeric_limits<float>::max());
+
+        const float beamDeweighting(this->GetBeamDeweightingScore(beamConstants, pVertex));
+        const float energyKick(LArMvaHelper::CalculateFeaturesOfType<EnergyKickFeatureTool>(m_featureToolVector, this, pVertex,
+            slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap, beamDeweighting, bestFastScore)
+                                   .at(0)
+                                   .Get());
+
+        preScores.at(index) = (beamDeweighting / m_beamDeweightingConstant) - (energyKick / m_energyKickConstant);
+    });
+
+    VertexScoreList preScoreList;
+    for (std::size_t index = 0; index < vertexVector.size(); ++index)
+        preScoreList.emplace_back(vertexVector.at(index), preScores.at(index));
+
+    std::sort(preScoreList.begin(), preScoreList.end());
+
+    // Each region is seeded by its highest pre-scoring candidate, with regions defined as in GetBestRegionVertices
+    typedef std::pair<const Vertex *, unsigned int> RegionSeed;
+    std::vector<RegionSeed> regionSeeds;
+    std::unordered_set<const Vertex *> retainedVertices;
+
+    for (const VertexScore &vertexScore : preScoreList)
+    {
+        const Vertex *const pVertex(vertexScore.GetVertex());
+        RegionSeed *pRegionSeed(nullptr);
+
+        for (RegionSeed &regionSeed : regionSeeds)
+        {
+            if ((regionSeed.first->GetPosition() - pVertex->GetPosition()).GetMagnitude() <= m_regionRadius)
+            {
+                pRegionSeed = &regionSeed;
+                break;
+            }
+        }
+
+        if (!pRegionSeed)
+        {
+            regionSeeds.emplace_back(pVertex, 1);
+            retainedVertices.insert(pVertex);
+        }
+        else if (pRegionSeed->second < m_maxCandidatesPerRegion)
+        {
+            ++(pRegionSeed->second);
+            retainedVertices.insert(pVertex);
+        }
+    }
+
+    for (const Vertex *const pVertex : vertexVector)
+    {
+        if (retainedVertices.count(pVertex))
+            candidateVertices.push_back(pVertex);
+    }
+
+    if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo() && !vertexVector.empty())
+    {
+        const float prunedFraction(static_cast<float>(vertexVector.size() - candidateVertices.size()) / static_cast<float>(vertexVector.size()));
+        std::cout << "TrainedVertexSelectionAlgorithm: retained " << candidateVertices.size() << " of " << vertexVector.size()
+                  << " vertex candidates in " << regionSeeds.size() << " regions, pruned fraction " << prunedFraction << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TrainedVertexSelectionAlgorithm::VertexFeatureInfo TrainedVertexSelectionAlgorithm::CalculateVertexFeatureInfo(const BeamConstants &beamConstants,
+    const ClusterListMap &clusterListMap, const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap,
+    const KDTreeMap &kdTreeMap, const Vertex *const pVertex) const
 {
     float bestFastScore(-std::numeric_limits<float>::max()); // not actually used - artefact of toolizing RPhi score and still using performance trick
 
@@ -465,8 +567,7 @@ void TrainedVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamCon
         vertexEnergy = this->GetVertexEnergy(pVertex, kdTreeMap);
     }
 
-    VertexFeatureInfo vertexFeatureInfo(beamDeweighting, 0.f, energyKick, localAsymmetry, globalAsymmetry, showerAsymmetry, dEdxAsymmetry, vertexEnergy);
-    vertexFeatureInfoMap.emplace(pVertex, vertexFeatureInfo);
+    return VertexFeatureInfo(beamDeweighting, 0.f, energyKick, localAsymmetry, globalAsymmetry, showerAsymmetry, dEdxAsymmetry, vertexEnergy);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -943,6 +1044,12 @@ StatusCode TrainedVertexSelectionAlgorithm::ReadSettings(const TiXmlHandle xmlHa
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "LegacyVariables", m_legacyVariables));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NFeatureThreads", m_nFeatureThreads));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "MaxCandidatesPerRegion", m_maxCandidatesPerRegion));
+
     if (m_trainingSetMode && m_legacyEventShapes)
         std::cout << "TrainedVertexSelectionAlgorithm: WARNING -- Producing training sample using incorrect legacy event shapes, consider turning LegacyEventShapes off"
                   << std::endl;
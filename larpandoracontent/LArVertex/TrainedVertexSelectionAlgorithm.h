@@ -295,7 +295,7 @@ protected:
     void AddEventFeaturesToVector(const EventFeatureInfo &eventFeatureInfo, LArMvaHelper::MvaFeatureVector &featureVector) const;
 
     /**
-     *  @brief  Populate the vertex feature info map for a given vertex
+     *  @brief  Calculate the vertex feature info for a given vertex. Only reads shared state, so may be called concurrently.
      *
      *  @param  beamConstants the beam constants
      *  @param  clusterListMap the cluster list map
@@ -303,11 +303,43 @@ protected:
      *  @param  showerClusterListMap the shower cluster list map
      *  @param  kdTreeMap the kd tree map
      *  @param  pVertex the vertex
+     *
+     *  @return the vertex feature info
+     */
+    VertexFeatureInfo CalculateVertexFeatureInfo(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
+        const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+        const pandora::Vertex *const pVertex) const;
+
+    /**
+     *  @brief  Populate the vertex feature info map for all vertices, evaluating the vertex features across the feature threads
+     *
+     *  @param  beamConstants the beam constants
+     *  @param  clusterListMap the cluster list map
+     *  @param  slidingFitDataListMap the sliding fit data list map
+     *  @param  showerClusterListMap the shower cluster list map
+     *  @param  kdTreeMap the kd tree map
+     *  @param  vertexVector the vector of vertices
      *  @param  vertexFeatureInfoMap the map to populate
      */
     void PopulateVertexFeatureInfoMap(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
         const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
-        const pandora::Vertex *const pVertex, VertexFeatureInfoMap &vertexFeatureInfoMap) const;
+        const pandora::VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap) const;
+
+    /**
+     *  @brief  Select the vertex candidates to receive full feature evaluation. A cheap pre-score, using only the beam deweighting and
+     *          energy kick features, ranks the candidates and only the top-ranked candidates in each region are retained.
+     *
+     *  @param  beamConstants the beam constants
+     *  @param  clusterListMap the cluster list map
+     *  @param  slidingFitDataListMap the sliding fit data list map
+     *  @param  showerClusterListMap the shower cluster list map
+     *  @param  kdTreeMap the kd tree map
+     *  @param  vertexVector the vector of all vertex candidates
+     *  @param  candidateVertices to receive the retained vertex candidates, in their original order
+     */
+    void PruneVertexCandidates(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
+        const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+        const pandora::VertexVector &vertexVector, pandora::VertexVector &candidateVertices) const;
 
     /**
      *  @brief  Populate the initial vertex score list for a given vertex
@@ -480,6 +512,8 @@ protected:
     bool m_testBeamMode;                      ///< Test beam mode
     bool m_legacyEventShapes;                 ///< Whether to use the old event shapes calculation
     bool m_legacyVariables;                   ///< Whether to only use the old variables
+    unsigned int m_nFeatureThreads;           ///< The number of threads used to evaluate vertex features, zero for hardware concurrency
+    unsigned int m_maxCandidatesPerRegion;    ///< The max number of pre-scored candidates per region to fully evaluate, zero to disable
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------